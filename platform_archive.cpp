@@ -0,0 +1,118 @@
+/**
+ * File: platform_archive.cpp
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 20:04:12
+ * Last Modified Date: 10/19/2026 08:15:34
+ */
+
+#include "platform_archive.h"
+
+const char *archive_normalize(const char *path)
+{
+    while (path[0] == '.' && path[1] == '/')
+        path += 2;
+    return path;
+}
+
+// NOTE(annad): Case-insensitive since the Memory Stick is.
+char archive_path_char(char ch)
+{
+    if (ch >= 'a' && ch <= 'z')
+        ch -= 'a' - 'A';
+    if (ch == '\\')
+        ch = '/';
+    return ch;
+}
+
+// NOTE(annad): FNV-1a over the normalized path.
+u32 archive_hash(const char *path)
+{
+    u32 hash = 2166136261u;
+    for (const char *c = archive_normalize(path); *c != '\0'; c++)
+    {
+        hash ^= (u8)archive_path_char(*c);
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+// NOTE(annad): Writes the form kept in ArchiveEntry::path, false if too long.
+bool archive_path_store(char *dst, const char *path)
+{
+    const char *c = archive_normalize(path);
+    int i = 0;
+    for (; c[i] != '\0'; i += 1)
+    {
+        if (i + 1 >= archive_path_size)
+            return false;
+        dst[i] = archive_path_char(c[i]);
+    }
+
+    for (; i < archive_path_size; i += 1)
+        dst[i] = '\0';
+    return true;
+}
+
+bool archive_path_equal(const char *stored, const char *path)
+{
+    const char *c = archive_normalize(path);
+    int i = 0;
+    for (; i < archive_path_size && c[i] != '\0'; i += 1)
+    {
+        if (stored[i] != archive_path_char(c[i]))
+            return false;
+    }
+
+    return i < archive_path_size && stored[i] == '\0';
+}
+
+const ArchiveEntry *archive_find(Archive *archive, const char *path)
+{
+    if (archive == NULL || archive->entries == NULL)
+        return NULL;
+
+    u32 hash = archive_hash(path);
+    int lo = 0;
+    int hi = (int)archive->header.entry_count - 1;
+    while (lo <= hi)
+    {
+        int mid = lo + (hi - lo) / 2;
+        u32 h = archive->entries[mid].hash;
+        if (h == hash)
+        {
+            // NOTE(annad): The tool rejects colliding entries, so a hash
+            // hit with another path means it isn't in the archive.
+            const ArchiveEntry *entry = &archive->entries[mid];
+            return archive_path_equal(entry->path, path) ? entry : NULL;
+        }
+        if (h < hash)
+            lo = mid + 1;
+        else
+            hi = mid - 1;
+    }
+
+    return NULL;
+}
+
+// NOTE(annad): Orders requests by file offset, missing paths go last.
+void archive_sort_paths(Archive *archive, const char **paths, int count)
+{
+    for (int i = 1; i < count; i += 1)
+    {
+        const char *path = paths[i];
+        const ArchiveEntry *entry = archive_find(archive, path);
+        u32 key = entry ? entry->offset : 0xffffffff;
+
+        int j = i;
+        while (j > 0)
+        {
+            const ArchiveEntry *prev = archive_find(archive, paths[j - 1]);
+            if ((prev ? prev->offset : 0xffffffff) <= key)
+                break;
+            paths[j] = paths[j - 1];
+            j -= 1;
+        }
+        paths[j] = path;
+    }
+}
@@ -0,0 +1,52 @@
+/**
+ * File: platform_archive.h
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 20:04:12
+ * Last Modified Date: 10/19/2026 08:15:34
+ */
+
+#pragma once
+
+// NOTE(annad): Archive layout, little endian:
+//   ArchiveHeader
+//   entry_count x ArchiveEntry, sorted by hash
+//   entry data, each entry starts on an alignment boundary, in TOC order
+// Paths are hashed after archive_normalize, "./OBJ/A.OBJ" == "OBJ/A.OBJ".
+// The normalized path is kept in the entry, a hash hit is checked against it.
+const u32 archive_magic = 0x304b4150; // NOTE(annad): "PAK0"
+const u32 archive_version = 2;
+const u32 archive_alignment = 2048;   // NOTE(annad): UMD/Memory Stick sector.
+const int archive_path_size = 64;     // NOTE(annad): Includes '\0'.
+
+enum
+{
+    ARCHIVE_ENTRY_LZ4 = 1 << 0, // NOTE(annad): Entry is platform_lz4 packed.
+};
+
+struct ArchiveHeader
+{
+    u32 magic;
+    u32 version;
+    u32 entry_count;
+    u32 alignment;
+};
+
+struct ArchiveEntry
+{
+    u32 hash;
+    u32 offset;
+    u32 size;
+    u32 flags;
+    char path[archive_path_size]; // NOTE(annad): Normalized, upper case.
+};
+
+struct Archive
+{
+    ArchiveHeader header;
+    ArchiveEntry *entries;
+};
+
+u32 archive_hash(const char *path);
+bool archive_path_store(char *dst, const char *path);
+const ArchiveEntry *archive_find(Archive *archive, const char *path);
+void archive_sort_paths(Archive *archive, const char **paths, int count);
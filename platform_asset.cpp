@@ -2,7 +2,7 @@
  * File: platform_asset.cpp
  * Author: github.com/annadostoevskaya
  * Date: 09/14/2023 23:49:20
- * Last Modified Date: 09/15/2023 00:40:23
+ * Last Modified Date: 10/19/2026 07:56:22
  */
 
 #include "platform_asset.h"
@@ -17,6 +17,7 @@ void asset_request(Asset *asset, const char *respath)
     asset->data = NULL;
     asset->uploaded = 0;
     asset->size = 0;
+    asset->packed_block_size = 0;
     asset->state = Asset::STATE_REQUESTED;
 }
 
@@ -31,6 +32,8 @@ void asset_complete(Asset *asset)
     asset->data = NULL;
     asset->uploaded = 0;
     asset->size = 0;
+    asset->stream = NULL;
+    asset->stream_user = NULL;
     asset->state = Asset::STATE_COMPLETED;
 }
 
@@ -50,12 +53,18 @@ void asset_processing(Asset *asset, Resource *res, Arena *arena)
             if (res->state == Resource::STATE_INACTIVE)
             {
                 asset_request(asset, res->path);
+                asset->stream = res->stream;
+                asset->stream_user = res->stream_user;
             }
         } break;
 
         case Asset::STATE_RESOLVED:
         {
-            void *data = arena_alloc(arena, asset->size);
+            size_t size = asset->size;
+            if (asset->stream != NULL)
+                size = asset_stream_slot_size * asset_stream_slots;
+
+            void *data = arena_alloc(arena, size);
             if (data == NULL)
             {
                 asset->state = Asset::STATE_UNDEFINED;
@@ -67,7 +76,7 @@ void asset_processing(Asset *asset, Resource *res, Arena *arena)
 
         case Asset::STATE_UPLOADED:
         {
-            res->data = asset->data; // pick up data
+            res->data = (asset->stream != NULL) ? NULL : asset->data; // pick up data
             res->size = asset->size;
             res->state = Resource::STATE_COMPLETED;
             asset_complete(asset);
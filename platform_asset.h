@@ -2,17 +2,27 @@
  * File: platform_asset.h
  * Author: github.com/annadostoevskaya
  * Date: 09/14/2023 23:50:10
- * Last Modified Date: 09/15/2023 00:19:58
+ * Last Modified Date: 10/19/2026 07:56:22
  */
 
 #pragma once
 
+// NOTE(annad): Streamed resources are handed to stream chunk by chunk while
+// uploading, data stays NULL and only the ring is allocated.
+const size_t asset_stream_slot_size = KB(64);
+const int asset_stream_slots = 2;
+
+typedef void (*AssetStream)(void *user, const char *data, size_t size);
+
 struct Resource
 {
     char *path;
     char *data;
     size_t size;
 
+    AssetStream stream;
+    void *stream_user;
+
     enum 
     {
         STATE_INACTIVE = 0,
@@ -32,6 +42,16 @@ struct Asset
     size_t size;
     size_t uploaded;
 
+    // NOTE(annad): Set by the platform for LZ4 packed files (platform_lz4.h),
+    // size is the unpacked size then. Blocks are read through staging.
+    char *staging;
+    size_t staging_size;
+    size_t packed_block_size;
+
+    // NOTE(annad): data is a ring of asset_stream_slots when stream is set.
+    AssetStream stream;
+    void *stream_user;
+
    enum 
    {
         STATE_INACTIVE = 0,
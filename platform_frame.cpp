@@ -0,0 +1,208 @@
+/**
+ * File: platform_frame.cpp
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 14:20:52
+ * Last Modified Date: 10/19/2026 08:23:45
+ */
+
+#include "platform_frame.h"
+
+void frame_init(FrameScheduler *scheduler, FrameClock *clock, u32 update_hz, SceFloat32 render_hz)
+{
+    u64 tps = clock->ticks_per_second;
+
+    scheduler->clock = clock;
+    scheduler->step_ticks = tps / update_hz;
+    scheduler->frame_ticks = (u64)((SceFloat32)tps / render_hz);
+    scheduler->spin_ticks = tps / 2000;   // NOTE(annad): 0.5ms
+    scheduler->vblank_ticks = tps / 1000; // NOTE(annad): 1ms
+    scheduler->dt = 1.0f / (SceFloat32)update_hz;
+
+    scheduler->accumulator = 0;
+    scheduler->last = clock->now(clock->ctx);
+    scheduler->deadline = scheduler->last + scheduler->frame_ticks;
+    scheduler->elapsed = scheduler->frame_ticks;
+
+    scheduler->frame_count = 0;
+    scheduler->dropped_steps = 0;
+    scheduler->late_frames = 0;
+    scheduler->min_ticks = (u64)-1;
+    scheduler->max_ticks = 0;
+    scheduler->sum_ticks = 0;
+    for (int i = 0; i < frame_histogram_buckets; i += 1)
+        scheduler->histogram[i] = 0;
+}
+
+// NOTE(annad): Returns how many fixed steps of dt to simulate this frame.
+// Past frame_max_steps whole steps are dropped, the remainder is kept.
+u32 frame_begin(FrameScheduler *scheduler)
+{
+    FrameClock *clock = scheduler->clock;
+    u64 now = clock->now(clock->ctx);
+    u64 elapsed = now - scheduler->last;
+    scheduler->last = now;
+    scheduler->elapsed = elapsed;
+
+    scheduler->frame_count += 1;
+    scheduler->sum_ticks += elapsed;
+    if (elapsed < scheduler->min_ticks) scheduler->min_ticks = elapsed;
+    if (elapsed > scheduler->max_ticks) scheduler->max_ticks = elapsed;
+
+    u64 us = elapsed * 1000000 / clock->ticks_per_second;
+    u64 bucket = us / frame_histogram_bucket_us;
+    if (bucket >= (u64)frame_histogram_buckets)
+        bucket = frame_histogram_buckets - 1;
+    scheduler->histogram[bucket] += 1;
+
+    scheduler->accumulator += elapsed;
+    u64 steps = scheduler->accumulator / scheduler->step_ticks;
+    if (steps > frame_max_steps)
+    {
+        scheduler->dropped_steps += steps - frame_max_steps;
+        scheduler->accumulator -= (steps - frame_max_steps) * scheduler->step_ticks;
+        steps = frame_max_steps;
+    }
+
+    scheduler->accumulator -= steps * scheduler->step_ticks;
+    return (u32)steps;
+}
+
+// NOTE(annad): Leftover fraction of a step, for render interpolation.
+SceFloat32 frame_alpha(FrameScheduler *scheduler)
+{
+    return (SceFloat32)scheduler->accumulator / (SceFloat32)scheduler->step_ticks;
+}
+
+// NOTE(annad): Sleeps the coarse part of the remaining time, spins the tail,
+// then lands on vblank when the clock has one.
+void frame_end(FrameScheduler *scheduler)
+{
+    FrameClock *clock = scheduler->clock;
+    u64 now = clock->now(clock->ctx);
+
+    if (now >= scheduler->deadline)
+    {
+        // NOTE(annad): Late, no wait at all (vblank included), restart pacing.
+        scheduler->late_frames += 1;
+        scheduler->deadline = now + scheduler->frame_ticks;
+        return;
+    }
+
+    // NOTE(annad): Inside the last vblank_ticks the spin would run past the
+    // vblank and wait_vblank would cost almost a whole refresh, go straight to it.
+    u64 target = scheduler->deadline;
+    if (clock->wait_vblank)
+        target = (target - now > scheduler->vblank_ticks) ? target - scheduler->vblank_ticks : now;
+
+    if (target - now > scheduler->spin_ticks)
+        clock->sleep(clock->ctx, target - now - scheduler->spin_ticks);
+
+    while (now < target)
+        now = clock->now(clock->ctx);
+
+    if (clock->wait_vblank)
+    {
+        clock->wait_vblank(clock->ctx);
+        now = clock->now(clock->ctx);
+        scheduler->deadline = now + scheduler->frame_ticks;
+    }
+    else
+    {
+        scheduler->deadline += scheduler->frame_ticks;
+    }
+}
+
+SceFloat32 frame_percentile_ms(FrameScheduler *scheduler, u32 percent)
+{
+    u64 rank = (scheduler->frame_count * percent + 99) / 100;
+    u64 seen = 0;
+    for (int i = 0; i < frame_histogram_buckets; i += 1)
+    {
+        seen += scheduler->histogram[i];
+        if (seen >= rank && seen > 0)
+            return (SceFloat32)((i + 1) * frame_histogram_bucket_us) / 1000.0f;
+    }
+
+    return (SceFloat32)(frame_histogram_buckets * frame_histogram_bucket_us) / 1000.0f;
+}
+
+u64 frame_fake_now(void *ctx)
+{
+    FrameFakeClock *fake = (FrameFakeClock*)ctx;
+    fake->tick += 1; // NOTE(annad): Spinning has to make progress.
+    return fake->tick;
+}
+
+void frame_fake_sleep(void *ctx, u64 ticks)
+{
+    FrameFakeClock *fake = (FrameFakeClock*)ctx;
+    fake->tick += ticks;
+}
+
+void frame_fake_wait_vblank(void *ctx)
+{
+    FrameFakeClock *fake = (FrameFakeClock*)ctx;
+    fake->tick += fake->vblank_period - fake->tick % fake->vblank_period;
+}
+
+FrameClock frame_fake_clock(FrameFakeClock *fake, u64 ticks_per_second)
+{
+    FrameClock clock = {};
+    clock.ctx = fake;
+    clock.now = frame_fake_now;
+    clock.sleep = frame_fake_sleep;
+    clock.wait_vblank = (fake->vblank_period != 0) ? frame_fake_wait_vblank : NULL;
+    clock.ticks_per_second = ticks_per_second;
+    return clock;
+}
+
+// NOTE(annad): Scripted 600 frames on a fake 1MHz clock with 59.94Hz vblank,
+// 4-10ms of work and a 90ms hitch every 100 frames. Deterministic, so the
+// counts are fixed and any pacing change shows up as a mismatch. Every 100
+// frames one also ends half a millisecond before its deadline. Overshoot is
+// the worst time an on-time frame_end returned past the first vblank it
+// could make, one vblank_ticks before the deadline or now if that's later.
+bool frame_replay(FrameReplay *replay)
+{
+    FrameFakeClock fake = {};
+    fake.vblank_period = 16683;
+    FrameClock clock = frame_fake_clock(&fake, 1000000);
+
+    FrameScheduler scheduler = {};
+    frame_init(&scheduler, &clock, 60, 59.94f);
+
+    replay->steps = 0;
+    replay->overshoot = 0;
+    for (int frame = 0; frame < 600; frame += 1)
+    {
+        replay->steps += frame_begin(&scheduler);
+
+        u64 work = 4000 + (frame % 7) * 1000;
+        if (frame % 100 == 50)
+            work = 90000; // NOTE(annad): Hitch, forces dropped steps.
+        if (frame % 100 == 75)
+            work = scheduler.deadline - fake.tick - 500; // NOTE(annad): Inside the vblank window.
+        fake.tick += work;
+
+        bool on_time = fake.tick < scheduler.deadline;
+        u64 earliest = scheduler.deadline - scheduler.vblank_ticks;
+        if (earliest < fake.tick)
+            earliest = fake.tick;
+        u64 vblank = earliest + fake.vblank_period - earliest % fake.vblank_period;
+
+        frame_end(&scheduler);
+        if (on_time && fake.tick > vblank + replay->overshoot)
+            replay->overshoot = fake.tick - vblank;
+    }
+
+    replay->late = (u32)scheduler.late_frames;
+    replay->dropped = (u32)scheduler.dropped_steps;
+    replay->avg_ms = (SceFloat32)scheduler.sum_ticks / (SceFloat32)scheduler.frame_count / 1000.0f;
+    replay->p50_ms = frame_percentile_ms(&scheduler, 50);
+    replay->p99_ms = frame_percentile_ms(&scheduler, 99);
+
+    return replay->steps == frame_replay_steps 
+        && replay->late == frame_replay_late 
+        && replay->dropped == frame_replay_dropped
+        && replay->overshoot <= frame_replay_max_overshoot;
+}
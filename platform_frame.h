@@ -0,0 +1,78 @@
+/**
+ * File: platform_frame.h
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 14:20:52
+ * Last Modified Date: 10/19/2026 08:23:45
+ */
+
+#pragma once
+
+// NOTE(annad): Clock is injected so pacing can be replayed with a fake one.
+struct FrameClock
+{
+    void *ctx;
+    u64 (*now)(void *ctx);
+    void (*sleep)(void *ctx, u64 ticks);
+    void (*wait_vblank)(void *ctx); // NOTE(annad): Optional.
+    u64 ticks_per_second;
+};
+
+const int frame_histogram_buckets = 64;
+const int frame_histogram_bucket_us = 500;
+const u32 frame_max_steps = 4;
+
+struct FrameScheduler
+{
+    FrameClock *clock;
+
+    u64 step_ticks;
+    u64 frame_ticks;
+    u64 spin_ticks;   // NOTE(annad): Tail of the wait spent spinning.
+    u64 vblank_ticks; // NOTE(annad): Wake up this much before vblank.
+    SceFloat32 dt;
+
+    u64 accumulator;
+    u64 last;
+    u64 deadline;
+    u64 elapsed;
+
+    u64 frame_count;
+    u64 dropped_steps;
+    u64 late_frames;
+    u64 min_ticks;
+    u64 max_ticks;
+    u64 sum_ticks;
+    u32 histogram[frame_histogram_buckets];
+};
+
+struct FrameFakeClock
+{
+    u64 tick;
+    u64 vblank_period;
+};
+
+void frame_init(FrameScheduler *scheduler, FrameClock *clock, u32 update_hz, SceFloat32 render_hz);
+u32 frame_begin(FrameScheduler *scheduler);
+SceFloat32 frame_alpha(FrameScheduler *scheduler);
+void frame_end(FrameScheduler *scheduler);
+SceFloat32 frame_percentile_ms(FrameScheduler *scheduler, u32 percent);
+
+// NOTE(annad): Expected results of frame_replay.
+const u32 frame_replay_steps = 623;
+const u32 frame_replay_late = 6;
+const u32 frame_replay_dropped = 6;
+const u64 frame_replay_max_overshoot = 1000; // NOTE(annad): Fake ticks, 1ms.
+
+struct FrameReplay
+{
+    u32 steps;
+    u32 late;
+    u32 dropped;
+    u64 overshoot; // NOTE(annad): Fake ticks.
+    SceFloat32 avg_ms;
+    SceFloat32 p50_ms;
+    SceFloat32 p99_ms;
+};
+
+FrameClock frame_fake_clock(FrameFakeClock *fake, u64 ticks_per_second);
+bool frame_replay(FrameReplay *replay);
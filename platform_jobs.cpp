@@ -0,0 +1,211 @@
+/**
+ * File: platform_jobs.cpp
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 15:32:47
+ * Last Modified Date: 10/19/2026 15:32:47
+ */
+
+#include "platform_jobs.h"
+
+void job_system_init(JobSystem *jobs, JobPlatform *platform, Arena *arena, int worker_count)
+{
+    jobs->platform = platform;
+    jobs->arena = arena;
+    jobs->worker_count = (worker_count < job_max_workers) ? worker_count : job_max_workers;
+    jobs->running = 1;
+    for (int i = 0; i < job_max_workers + 1; i += 1)
+    {
+        jobs->deques[i].top = 0;
+        jobs->deques[i].bottom = 0;
+    }
+}
+
+void job_system_stop(JobSystem *jobs)
+{
+    jobs->running = 0;
+    jobs->platform->wake(jobs->platform->ctx, jobs->worker_count);
+}
+
+Job *job_create(JobSystem *jobs, JobFunc func, void *data, JobCounter *counter)
+{
+    JobPlatform *platform = jobs->platform;
+    platform->lock(platform->ctx, job_lock_shared);
+    Job *job = (Job*)arena_alloc(jobs->arena, sizeof(Job));
+    platform->unlock(platform->ctx, job_lock_shared);
+
+    if (job == NULL)
+        return NULL;
+
+    job->func = func;
+    job->data = data;
+    job->counter = counter;
+    job->next = NULL;
+    return job;
+}
+
+bool job_push(JobSystem *jobs, int thread, Job *job)
+{
+    JobPlatform *platform = jobs->platform;
+    JobDeque *deque = &jobs->deques[thread];
+
+    platform->lock(platform->ctx, thread);
+    bool pushed = (deque->bottom - deque->top < job_deque_size);
+    if (pushed)
+    {
+        deque->jobs[deque->bottom & (job_deque_size - 1)] = job;
+        deque->bottom += 1;
+    }
+    platform->unlock(platform->ctx, thread);
+
+    if (pushed)
+        platform->wake(platform->ctx, 1);
+    return pushed;
+}
+
+Job *job_get(JobSystem *jobs, int thread)
+{
+    JobPlatform *platform = jobs->platform;
+    Job *job = NULL;
+
+    // NOTE(annad): Own deque LIFO, keeps the freshest data in cache.
+    JobDeque *deque = &jobs->deques[thread];
+    platform->lock(platform->ctx, thread);
+    if (deque->bottom > deque->top)
+    {
+        deque->bottom -= 1;
+        job = deque->jobs[deque->bottom & (job_deque_size - 1)];
+    }
+    platform->unlock(platform->ctx, thread);
+
+    // NOTE(annad): Steal FIFO from the others, the oldest (biggest) work first.
+    for (int i = 1; job == NULL && i < jobs->worker_count + 1; i += 1)
+    {
+        int victim = (thread + i) % (jobs->worker_count + 1);
+        JobDeque *other = &jobs->deques[victim];
+        platform->lock(platform->ctx, victim);
+        if (other->bottom > other->top)
+        {
+            job = other->jobs[other->top & (job_deque_size - 1)];
+            other->top += 1;
+        }
+        platform->unlock(platform->ctx, victim);
+    }
+
+    return job;
+}
+
+void job_execute(JobSystem *jobs, int thread, Job *job)
+{
+    job->func(job->data);
+
+    JobCounter *counter = job->counter;
+    if (counter == NULL)
+        return;
+
+    JobPlatform *platform = jobs->platform;
+    platform->lock(platform->ctx, job_lock_shared);
+    counter->value -= 1;
+    bool finished = (counter->value == 0);
+    Job *continuations = NULL;
+    if (finished)
+    {
+        continuations = counter->continuations;
+        counter->continuations = NULL;
+    }
+    platform->unlock(platform->ctx, job_lock_shared);
+
+    while (continuations != NULL)
+    {
+        Job *next = continuations->next;
+        if (!job_push(jobs, thread, continuations))
+            job_execute(jobs, thread, continuations);
+        continuations = next;
+    }
+
+    // NOTE(annad): Waiters may sleep on an empty queue, let them recheck.
+    if (finished)
+        platform->wake(platform->ctx, jobs->worker_count + 1);
+}
+
+void job_run(JobSystem *jobs, int thread, Job *job)
+{
+    if (job->counter != NULL)
+    {
+        JobPlatform *platform = jobs->platform;
+        platform->lock(platform->ctx, job_lock_shared);
+        job->counter->value += 1;
+        platform->unlock(platform->ctx, job_lock_shared);
+    }
+
+    if (!job_push(jobs, thread, job))
+        job_execute(jobs, thread, job);
+}
+
+// NOTE(annad): Job starts once dependency reaches zero, its own counter
+// is taken right away so waiting on it also waits on the dependency.
+void job_run_after(JobSystem *jobs, int thread, JobCounter *dependency, Job *job)
+{
+    JobPlatform *platform = jobs->platform;
+    platform->lock(platform->ctx, job_lock_shared);
+    if (job->counter != NULL)
+        job->counter->value += 1;
+
+    bool ready = (dependency->value == 0);
+    if (!ready)
+    {
+        job->next = dependency->continuations;
+        dependency->continuations = job;
+    }
+    platform->unlock(platform->ctx, job_lock_shared);
+
+    if (ready && !job_push(jobs, thread, job))
+        job_execute(jobs, thread, job);
+}
+
+// NOTE(annad): Runs inline when the frame arena is exhausted.
+void job_spawn(JobSystem *jobs, int thread, JobFunc func, void *data, JobCounter *counter)
+{
+    Job *job = job_create(jobs, func, data, counter);
+    if (job == NULL)
+    {
+        func(data);
+        return;
+    }
+
+    job_run(jobs, thread, job);
+}
+
+bool job_counter_done(JobSystem *jobs, JobCounter *counter)
+{
+    // NOTE(annad): Under the lock, so results of finished jobs are visible.
+    JobPlatform *platform = jobs->platform;
+    platform->lock(platform->ctx, job_lock_shared);
+    bool done = (counter->value == 0);
+    platform->unlock(platform->ctx, job_lock_shared);
+    return done;
+}
+
+// NOTE(annad): Caller helps executing jobs instead of blocking.
+void job_wait(JobSystem *jobs, int thread, JobCounter *counter)
+{
+    while (!job_counter_done(jobs, counter))
+    {
+        Job *job = job_get(jobs, thread);
+        if (job != NULL)
+            job_execute(jobs, thread, job);
+        else
+            jobs->platform->idle(jobs->platform->ctx);
+    }
+}
+
+void job_worker_loop(JobSystem *jobs, int thread)
+{
+    while (jobs->running)
+    {
+        Job *job = job_get(jobs, thread);
+        if (job != NULL)
+            job_execute(jobs, thread, job);
+        else
+            jobs->platform->idle(jobs->platform->ctx);
+    }
+}
@@ -0,0 +1,68 @@
+/**
+ * File: platform_jobs.h
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 15:32:47
+ * Last Modified Date: 10/19/2026 15:32:47
+ */
+
+#pragma once
+
+const int job_max_workers = 4;
+const int job_deque_size = 256; // NOTE(annad): Power of two.
+
+// NOTE(annad): Lock ids passed to JobPlatform::lock, one per deque
+// (0 is the main thread) and one for counters and the frame arena.
+const int job_lock_shared = job_max_workers + 1;
+
+typedef void (*JobFunc)(void *data);
+
+struct Job;
+
+struct JobCounter
+{
+    volatile int value;
+    Job *continuations; // NOTE(annad): Pushed when value drops to zero.
+};
+
+struct Job
+{
+    JobFunc func;
+    void *data;
+    JobCounter *counter;
+    Job *next;
+};
+
+struct JobDeque
+{
+    Job *jobs[job_deque_size];
+    int top;    // NOTE(annad): Thieves take from here.
+    int bottom; // NOTE(annad): Owner pushes and pops here.
+};
+
+struct JobPlatform
+{
+    void *ctx;
+    void (*lock)(void *ctx, int id);
+    void (*unlock)(void *ctx, int id);
+    void (*wake)(void *ctx, int count);
+    void (*idle)(void *ctx); // NOTE(annad): Block until woken or yield.
+};
+
+struct JobSystem
+{
+    JobPlatform *platform;
+    Arena *arena; // NOTE(annad): Frame arena, jobs live until it is reset.
+    JobDeque deques[job_max_workers + 1];
+    int worker_count;
+    volatile int running;
+};
+
+void job_system_init(JobSystem *jobs, JobPlatform *platform, Arena *arena, int worker_count);
+void job_system_stop(JobSystem *jobs);
+
+Job *job_create(JobSystem *jobs, JobFunc func, void *data, JobCounter *counter);
+void job_run(JobSystem *jobs, int thread, Job *job);
+void job_run_after(JobSystem *jobs, int thread, JobCounter *dependency, Job *job);
+void job_spawn(JobSystem *jobs, int thread, JobFunc func, void *data, JobCounter *counter);
+void job_wait(JobSystem *jobs, int thread, JobCounter *counter);
+void job_worker_loop(JobSystem *jobs, int thread);
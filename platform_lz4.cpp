@@ -0,0 +1,73 @@
+/**
+ * File: platform_lz4.cpp
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 18:35:21
+ * Last Modified Date: 10/19/2026 18:35:21
+ */
+
+#include "platform_lz4.h"
+
+// NOTE(annad): LZ4 block format decoder, returns unpacked size or -1 on
+// malformed input. Never reads or writes out of the given ranges.
+int lz4_decompress(const u8 *src, size_t src_size, u8 *dst, size_t dst_size)
+{
+    const u8 *ip = src;
+    const u8 *iend = src + src_size;
+    u8 *op = dst;
+    u8 *oend = dst + dst_size;
+
+    while (ip < iend)
+    {
+        u32 token = *ip++;
+
+        size_t literals = token >> 4;
+        if (literals == 15)
+        {
+            u32 b = 255;
+            while (b == 255 && ip < iend)
+            {
+                b = *ip++;
+                literals += b;
+            }
+        }
+
+        if ((size_t)(iend - ip) < literals || (size_t)(oend - op) < literals)
+            return -1;
+        for (size_t i = 0; i < literals; i += 1)
+            *op++ = *ip++;
+
+        // NOTE(annad): Last sequence has literals only.
+        if (ip == iend)
+            break;
+
+        if (iend - ip < 2)
+            return -1;
+        size_t offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (size_t)(op - dst))
+            return -1;
+
+        size_t length = (token & 0xf) + 4;
+        if ((token & 0xf) == 15)
+        {
+            u32 b = 255;
+            while (b == 255)
+            {
+                if (ip == iend)
+                    return -1;
+                b = *ip++;
+                length += b;
+            }
+        }
+
+        if ((size_t)(oend - op) < length)
+            return -1;
+
+        // NOTE(annad): Byte copy, overlapping matches repeat the pattern.
+        const u8 *match = op - offset;
+        for (size_t i = 0; i < length; i += 1)
+            *op++ = *match++;
+    }
+
+    return (int)(op - dst);
+}
@@ -0,0 +1,28 @@
+/**
+ * File: platform_lz4.h
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 18:35:21
+ * Last Modified Date: 10/19/2026 18:35:21
+ */
+
+#pragma once
+
+// NOTE(annad): Packed asset layout, little endian:
+//   Lz4Header
+//   block_count x { u32 size | lz4_block_stored, size bytes }
+// Every block unpacks to block_size bytes (the last one to the rest).
+// Blocks that don't shrink are stored as is, so a block never needs
+// more than block_size bytes of staging.
+const u32 lz4_magic = 0x42345a4c; // NOTE(annad): "LZ4B"
+const u32 lz4_block_size = 64 * 1024;
+const u32 lz4_block_stored = 0x80000000;
+
+struct Lz4Header
+{
+    u32 magic;
+    u32 raw_size;
+    u32 block_size;
+    u32 block_count;
+};
+
+int lz4_decompress(const u8 *src, size_t src_size, u8 *dst, size_t dst_size);
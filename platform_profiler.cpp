@@ -0,0 +1,242 @@
+/**
+ * File: platform_profiler.cpp
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 13:05:40
+ * Last Modified Date: 10/19/2026 08:22:52
+ */
+
+#include "platform_profiler.h"
+
+#if PROFILER_ENABLED
+Profiler global_profiler;
+#endif
+
+void profiler_init(Profiler *profiler, u64 (*clock)(), u64 ticks_per_second)
+{
+    profiler->clock = clock;
+    profiler->ticks_per_second = ticks_per_second;
+    profiler->zone_count = 0;
+    profiler->stack_depth = 0;
+    profiler->frame_count = 0;
+    profiler->event_count = 0;
+
+    ProfilerFrame *frame = &profiler->frames[0];
+    frame->begin = (clock != NULL) ? clock() : 0;
+    for (int i = 0; i < profiler_max_zones; i += 1)
+    {
+        frame->ticks[i] = 0;
+        frame->calls[i] = 0;
+    }
+}
+
+int profiler_zone(Profiler *profiler, const char *name)
+{
+    for (int i = 0; i < profiler->zone_count; i += 1)
+    {
+        const char *a = profiler->zones[i].name;
+        const char *b = name;
+        while (*a != '\0' && *a == *b)
+        {
+            a++;
+            b++;
+        }
+
+        if (*a == *b)
+            return i;
+    }
+
+    if (profiler->zone_count == profiler_max_zones)
+        return profiler_max_zones - 1; // NOTE(annad): Overflow goes to last zone.
+
+    int zone = profiler->zone_count++;
+    profiler->zones[zone].name = name;
+    profiler->zones[zone].parent = -1;
+    profiler->zones[zone].depth = -1;
+    return zone;
+}
+
+// NOTE(annad): Returns false when nothing was pushed, the caller must not
+// call profiler_end for it then.
+bool profiler_begin(Profiler *profiler, int zone)
+{
+    if (profiler->clock == NULL || profiler->stack_depth == profiler_max_depth)
+        return false;
+
+    ProfilerZone *z = &profiler->zones[zone];
+    if (z->depth < 0)
+    {
+        int depth = profiler->stack_depth;
+        z->depth = depth;
+        z->parent = (depth > 0) ? profiler->stack[depth - 1].zone : -1;
+    }
+
+    ProfilerFrame *frame = &profiler->frames[profiler->frame_count % profiler_history];
+    frame->calls[zone] += 1;
+
+    profiler->stack[profiler->stack_depth].zone = zone;
+    profiler->stack[profiler->stack_depth].begin = profiler->clock();
+    profiler->stack_depth += 1;
+    return true;
+}
+
+void profiler_end(Profiler *profiler)
+{
+    if (profiler->clock == NULL || profiler->stack_depth == 0)
+        return;
+
+    u64 end = profiler->clock();
+    profiler->stack_depth -= 1;
+    int zone = profiler->stack[profiler->stack_depth].zone;
+    u64 begin = profiler->stack[profiler->stack_depth].begin;
+
+    ProfilerFrame *frame = &profiler->frames[profiler->frame_count % profiler_history];
+    frame->ticks[zone] += end - begin;
+
+    ProfilerEvent *event = &profiler->events[profiler->event_count % profiler_max_events];
+    event->begin = begin;
+    event->end = end;
+    event->zone = (u16)zone;
+    event->depth = (u16)profiler->stack_depth;
+    profiler->event_count += 1;
+}
+
+// NOTE(annad): Closes the current frame and opens the next ring slot.
+void profiler_frame(Profiler *profiler)
+{
+    if (profiler->clock == NULL)
+        return;
+
+    profiler->frame_count += 1;
+    ProfilerFrame *frame = &profiler->frames[profiler->frame_count % profiler_history];
+    frame->begin = profiler->clock();
+    for (int i = 0; i < profiler_max_zones; i += 1)
+    {
+        frame->ticks[i] = 0;
+        frame->calls[i] = 0;
+    }
+}
+
+bool profiler_stats(Profiler *profiler, int zone, ProfilerStats *stats)
+{
+    // NOTE(annad): Only closed frames, the current one is still in flight.
+    u32 count = profiler->frame_count;
+    if (count > (u32)profiler_history - 1)
+        count = profiler_history - 1;
+    if (count == 0 || profiler->ticks_per_second == 0)
+        return false;
+
+    u64 sorted[profiler_history];
+    u64 total_ticks = 0;
+    u64 total_calls = 0;
+    for (u32 i = 0; i < count; i += 1)
+    {
+        u32 index = (profiler->frame_count - 1 - i) % profiler_history;
+        u64 ticks = profiler->frames[index].ticks[zone];
+        total_ticks += ticks;
+        total_calls += profiler->frames[index].calls[zone];
+
+        // NOTE(annad): Insertion sort, history is small.
+        u32 j = i;
+        while (j > 0 && sorted[j - 1] > ticks)
+        {
+            sorted[j] = sorted[j - 1];
+            j -= 1;
+        }
+        sorted[j] = ticks;
+    }
+
+    u32 p99 = (count * 99) / 100;
+    if (p99 >= count)
+        p99 = count - 1;
+
+    SceFloat32 ms_per_tick = 1000.0f / (SceFloat32)profiler->ticks_per_second;
+    stats->min_ms = (SceFloat32)sorted[0] * ms_per_tick;
+    stats->avg_ms = (SceFloat32)total_ticks / (SceFloat32)count * ms_per_tick;
+    stats->p99_ms = (SceFloat32)sorted[p99] * ms_per_tick;
+    stats->calls = (SceFloat32)total_calls / (SceFloat32)count;
+    return true;
+}
+
+void profiler_print(Profiler *profiler, TextOverlay *text)
+{
+    for (int i = 0; i < profiler->zone_count; i += 1)
+    {
+        ProfilerStats stats;
+        if (!profiler_stats(profiler, i, &stats))
+            continue;
+
+        ProfilerZone *zone = &profiler->zones[i];
+        for (int depth = 0; depth < zone->depth; depth += 1)
+            text_str(text, "  ");
+        text_str(text, zone->name);
+        text_str(text, " X");
+        text_float(text, stats.calls, 0);
+        text_str(text, ": AVG ");
+        text_float(text, stats.avg_ms, 3);
+        text_str(text, " MIN ");
+        text_float(text, stats.min_ms, 3);
+        text_str(text, " P99 ");
+        text_float(text, stats.p99_ms, 3);
+        text_str(text, " MS");
+        text_newline(text);
+    }
+}
+
+size_t profiler_write_str(char *dst, size_t dst_size, size_t at, const char *str)
+{
+    while (*str != '\0' && at < dst_size)
+        dst[at++] = *str++;
+    return at;
+}
+
+size_t profiler_write_u64(char *dst, size_t dst_size, size_t at, u64 value)
+{
+    char digits[20];
+    int count = 0;
+    do
+    {
+        digits[count++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    while (count > 0 && at < dst_size)
+        dst[at++] = digits[--count];
+    return at;
+}
+
+// NOTE(annad): Chrome trace event format (chrome://tracing, ui.perfetto.dev),
+// returns written bytes, the event ring is exported from oldest to newest.
+size_t profiler_trace_json(Profiler *profiler, char *dst, size_t dst_size)
+{
+    u32 count = profiler->event_count;
+    if (count > (u32)profiler_max_events)
+        count = profiler_max_events;
+    u32 first = profiler->event_count - count;
+
+    u64 base = (count > 0) ? profiler->events[first % profiler_max_events].begin : 0;
+    for (u32 i = 0; i < count; i += 1)
+    {
+        u64 begin = profiler->events[(first + i) % profiler_max_events].begin;
+        if (begin < base)
+            base = begin;
+    }
+
+    size_t at = 0;
+    at = profiler_write_str(dst, dst_size, at, "{\"traceEvents\":[\n");
+    for (u32 i = 0; i < count; i += 1)
+    {
+        ProfilerEvent *event = &profiler->events[(first + i) % profiler_max_events];
+        u64 ts = (event->begin - base) * 1000000 / profiler->ticks_per_second;
+        u64 dur = (event->end - event->begin) * 1000000 / profiler->ticks_per_second;
+
+        at = profiler_write_str(dst, dst_size, at, (i == 0) ? "{\"name\":\"" : ",\n{\"name\":\"");
+        at = profiler_write_str(dst, dst_size, at, profiler->zones[event->zone].name);
+        at = profiler_write_str(dst, dst_size, at, "\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":");
+        at = profiler_write_u64(dst, dst_size, at, ts);
+        at = profiler_write_str(dst, dst_size, at, ",\"dur\":");
+        at = profiler_write_u64(dst, dst_size, at, dur);
+        at = profiler_write_str(dst, dst_size, at, "}");
+    }
+    at = profiler_write_str(dst, dst_size, at, "\n]}\n");
+    return at;
+}
@@ -0,0 +1,111 @@
+/**
+ * File: platform_profiler.h
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 13:05:40
+ * Last Modified Date: 10/19/2026 08:22:52
+ */
+
+#pragma once
+
+// NOTE(annad): -DPROFILER_ENABLED=0 removes the profiler entirely,
+// by default it follows DEBUG_BUILD.
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED DEBUG_BUILD
+#endif
+
+const int profiler_max_zones = 32;
+const int profiler_max_depth = 16;
+const int profiler_history = 128; // NOTE(annad): Frames kept in the ring.
+const int profiler_max_events = 4096;
+
+// NOTE(annad): parent and depth are taken from the zone's first use and
+// only indent profiler_print. A zone entered under another parent later
+// keeps them, the nesting of every call is in ProfilerEvent::depth.
+struct ProfilerZone
+{
+    const char *name;
+    int parent;
+    int depth;
+};
+
+struct ProfilerFrame
+{
+    u64 begin;
+    u64 ticks[profiler_max_zones];
+    u32 calls[profiler_max_zones];
+};
+
+struct ProfilerEvent
+{
+    u64 begin;
+    u64 end;
+    u16 zone;
+    u16 depth;
+};
+
+struct ProfilerStats
+{
+    SceFloat32 min_ms;
+    SceFloat32 avg_ms;
+    SceFloat32 p99_ms;
+    SceFloat32 calls;
+};
+
+struct Profiler
+{
+    u64 (*clock)();
+    u64 ticks_per_second;
+
+    ProfilerZone zones[profiler_max_zones];
+    int zone_count;
+
+    struct
+    {
+        int zone;
+        u64 begin;
+    } stack[profiler_max_depth];
+    int stack_depth;
+
+    ProfilerFrame frames[profiler_history];
+    u32 frame_count;
+
+    ProfilerEvent events[profiler_max_events];
+    u32 event_count;
+};
+
+void profiler_init(Profiler *profiler, u64 (*clock)(), u64 ticks_per_second);
+int profiler_zone(Profiler *profiler, const char *name);
+bool profiler_begin(Profiler *profiler, int zone);
+void profiler_end(Profiler *profiler);
+void profiler_frame(Profiler *profiler);
+bool profiler_stats(Profiler *profiler, int zone, ProfilerStats *stats);
+void profiler_print(Profiler *profiler, TextOverlay *text);
+size_t profiler_trace_json(Profiler *profiler, char *dst, size_t dst_size);
+
+#if PROFILER_ENABLED
+
+extern Profiler global_profiler;
+
+// NOTE(annad): Past profiler_max_depth nothing is pushed, so nothing is
+// popped either, the enclosing zone keeps its entry.
+struct ProfilerScope
+{
+    bool pushed;
+    ProfilerScope(int zone) { pushed = profiler_begin(&global_profiler, zone); }
+    ~ProfilerScope() { if (pushed) profiler_end(&global_profiler); }
+};
+
+#define PROFILER_CONCAT_(a, b) a ## b
+#define PROFILER_CONCAT(a, b) PROFILER_CONCAT_(a, b)
+
+#define PROFILE_ZONE(name) \
+        static int PROFILER_CONCAT(profiler_Zone, __LINE__) = \
+            profiler_zone(&global_profiler, name); \
+        ProfilerScope PROFILER_CONCAT(profiler_Scope, __LINE__)( \
+            PROFILER_CONCAT(profiler_Zone, __LINE__))
+
+#else
+
+#define PROFILE_ZONE(name)
+
+#endif
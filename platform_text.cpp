@@ -0,0 +1,237 @@
+/**
+ * File: platform_text.cpp
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 17:40:03
+ * Last Modified Date: 10/19/2026 17:40:03
+ */
+
+#include <string.h>
+#include "platform_text.h"
+
+// NOTE(annad): 5x7 glyphs in 8x8 cells, one byte per row, MSB is left.
+const u8 text_font[text_glyph_count * text_glyph_size] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // space
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00, // !
+    0x50, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, // "
+    0x50, 0x50, 0xf8, 0x50, 0xf8, 0x50, 0x50, 0x00, // #
+    0x20, 0x78, 0xa0, 0x70, 0x28, 0xf0, 0x20, 0x00, // $
+    0xc0, 0xc8, 0x10, 0x20, 0x40, 0x98, 0x18, 0x00, // %
+    0x60, 0x90, 0xa0, 0x40, 0xa8, 0x90, 0x68, 0x00, // &
+    0x20, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, // '
+    0x10, 0x20, 0x40, 0x40, 0x40, 0x20, 0x10, 0x00, // (
+    0x40, 0x20, 0x10, 0x10, 0x10, 0x20, 0x40, 0x00, // )
+    0x00, 0x20, 0xa8, 0x70, 0xa8, 0x20, 0x00, 0x00, // *
+    0x00, 0x20, 0x20, 0xf8, 0x20, 0x20, 0x00, 0x00, // +
+    0x00, 0x00, 0x00, 0x00, 0x60, 0x20, 0x40, 0x00, // ,
+    0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, // -
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, // .
+    0x00, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00, // /
+    0x70, 0x88, 0x98, 0xa8, 0xc8, 0x88, 0x70, 0x00, // 0
+    0x20, 0x60, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00, // 1
+    0x70, 0x88, 0x08, 0x10, 0x20, 0x40, 0xf8, 0x00, // 2
+    0xf8, 0x10, 0x20, 0x10, 0x08, 0x88, 0x70, 0x00, // 3
+    0x10, 0x30, 0x50, 0x90, 0xf8, 0x10, 0x10, 0x00, // 4
+    0xf8, 0x80, 0xf0, 0x08, 0x08, 0x88, 0x70, 0x00, // 5
+    0x30, 0x40, 0x80, 0xf0, 0x88, 0x88, 0x70, 0x00, // 6
+    0xf8, 0x08, 0x10, 0x20, 0x40, 0x40, 0x40, 0x00, // 7
+    0x70, 0x88, 0x88, 0x70, 0x88, 0x88, 0x70, 0x00, // 8
+    0x70, 0x88, 0x88, 0x78, 0x08, 0x10, 0x60, 0x00, // 9
+    0x00, 0x60, 0x60, 0x00, 0x60, 0x60, 0x00, 0x00, // :
+    0x00, 0x60, 0x60, 0x00, 0x60, 0x20, 0x40, 0x00, // ;
+    0x10, 0x20, 0x40, 0x80, 0x40, 0x20, 0x10, 0x00, // <
+    0x00, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0x00, 0x00, // =
+    0x40, 0x20, 0x10, 0x08, 0x10, 0x20, 0x40, 0x00, // >
+    0x70, 0x88, 0x08, 0x10, 0x20, 0x00, 0x20, 0x00, // ?
+    0x70, 0x88, 0x08, 0x68, 0xa8, 0xa8, 0x70, 0x00, // @
+    0x70, 0x88, 0x88, 0xf8, 0x88, 0x88, 0x88, 0x00, // A
+    0xf0, 0x88, 0x88, 0xf0, 0x88, 0x88, 0xf0, 0x00, // B
+    0x70, 0x88, 0x80, 0x80, 0x80, 0x88, 0x70, 0x00, // C
+    0xe0, 0x90, 0x88, 0x88, 0x88, 0x90, 0xe0, 0x00, // D
+    0xf8, 0x80, 0x80, 0xf0, 0x80, 0x80, 0xf8, 0x00, // E
+    0xf8, 0x80, 0x80, 0xf0, 0x80, 0x80, 0x80, 0x00, // F
+    0x70, 0x88, 0x80, 0xb8, 0x88, 0x88, 0x78, 0x00, // G
+    0x88, 0x88, 0x88, 0xf8, 0x88, 0x88, 0x88, 0x00, // H
+    0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00, // I
+    0x38, 0x10, 0x10, 0x10, 0x10, 0x90, 0x60, 0x00, // J
+    0x88, 0x90, 0xa0, 0xc0, 0xa0, 0x90, 0x88, 0x00, // K
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xf8, 0x00, // L
+    0x88, 0xd8, 0xa8, 0xa8, 0x88, 0x88, 0x88, 0x00, // M
+    0x88, 0x88, 0xc8, 0xa8, 0x98, 0x88, 0x88, 0x00, // N
+    0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, // O
+    0xf0, 0x88, 0x88, 0xf0, 0x80, 0x80, 0x80, 0x00, // P
+    0x70, 0x88, 0x88, 0x88, 0xa8, 0x90, 0x68, 0x00, // Q
+    0xf0, 0x88, 0x88, 0xf0, 0xa0, 0x90, 0x88, 0x00, // R
+    0x78, 0x80, 0x80, 0x70, 0x08, 0x08, 0xf0, 0x00, // S
+    0xf8, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, // T
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, // U
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x50, 0x20, 0x00, // V
+    0x88, 0x88, 0x88, 0xa8, 0xa8, 0xa8, 0x50, 0x00, // W
+    0x88, 0x88, 0x50, 0x20, 0x50, 0x88, 0x88, 0x00, // X
+    0x88, 0x88, 0x50, 0x20, 0x20, 0x20, 0x20, 0x00, // Y
+    0xf8, 0x08, 0x10, 0x20, 0x40, 0x80, 0xf8, 0x00, // Z
+    0x70, 0x40, 0x40, 0x40, 0x40, 0x40, 0x70, 0x00, // [
+    0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x00, 0x00, // backslash
+    0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x70, 0x00, // ]
+    0x20, 0x50, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, // ^
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, // _
+};
+
+void text_init(TextOverlay *text, u32 color)
+{
+    for (int g = 0; g < text_glyph_count; g += 1)
+    {
+        for (int r = 0; r < text_glyph_size; r += 1)
+        {
+            u8 bits = text_font[g * text_glyph_size + r];
+            u32 *row = &text->atlas[(g * text_glyph_size + r) * text_glyph_size];
+            for (int c = 0; c < text_glyph_size; c += 1)
+                row[c] = (bits & (0x80 >> c)) ? color : 0;
+        }
+    }
+
+    for (int i = 0; i < text_max_lines; i += 1)
+        text->lines[i].valid = 0;
+    text->line_count = 0;
+    text->scratch_length = 0;
+    text->lines_cached = 0;
+    text->lines_rasterized = 0;
+}
+
+void text_begin(TextOverlay *text)
+{
+    text->line_count = 0;
+    text->scratch_length = 0;
+}
+
+void text_char(TextOverlay *text, char c)
+{
+    if (text->scratch_length < text_max_columns)
+        text->scratch[text->scratch_length++] = c;
+}
+
+void text_str(TextOverlay *text, const char *str)
+{
+    while (*str != '\0')
+        text_char(text, *str++);
+}
+
+void text_int(TextOverlay *text, int value)
+{
+    u32 magnitude = (value < 0) ? (u32)(-(value + 1)) + 1 : (u32)value;
+    if (value < 0)
+        text_char(text, '-');
+
+    char digits[10];
+    int count = 0;
+    do
+    {
+        digits[count++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+
+    while (count > 0)
+        text_char(text, digits[--count]);
+}
+
+// NOTE(annad): Fixed point, no vsnprintf. Values past 2^31 / 10^decimals
+// are clamped, it's a debug overlay.
+void text_float(TextOverlay *text, SceFloat32 value, int decimals)
+{
+    int scale = 1;
+    for (int i = 0; i < decimals; i += 1)
+        scale *= 10;
+
+    if (value < 0.0f)
+    {
+        text_char(text, '-');
+        value = -value;
+    }
+
+    SceFloat32 limit = 2147483647.0f / (SceFloat32)scale;
+    if (!(value < limit))
+        value = limit;
+
+    u32 fixed = (u32)(value * (SceFloat32)scale + 0.5f);
+    text_int(text, (int)(fixed / scale));
+    if (decimals == 0)
+        return;
+
+    text_char(text, '.');
+    u32 fraction = fixed % scale;
+    for (int div = scale / 10; div > 0; div /= 10)
+    {
+        text_char(text, (char)('0' + fraction / div));
+        fraction %= div;
+    }
+}
+
+void text_rasterize(TextOverlay *text, TextLine *line)
+{
+    int pitch = text_max_columns * text_glyph_size;
+    for (int i = 0; i < line->length; i += 1)
+    {
+        int c = (u8)line->chars[i];
+        if (c >= 'a' && c <= 'z')
+            c -= 'a' - 'A';
+        int g = c - text_first_char;
+        if (g < 0 || g >= text_glyph_count)
+            g = '?' - text_first_char;
+
+        const u32 *src = &text->atlas[g * text_glyph_size * text_glyph_size];
+        u32 *dst = &line->pixels[i * text_glyph_size];
+        for (int r = 0; r < text_glyph_size; r += 1)
+            memcpy(dst + r * pitch, src + r * text_glyph_size, text_glyph_size * sizeof(u32));
+    }
+
+    text->lines_rasterized += 1;
+}
+
+void text_newline(TextOverlay *text)
+{
+    if (text->line_count == text_max_lines)
+    {
+        text->scratch_length = 0;
+        return;
+    }
+
+    TextLine *line = &text->lines[text->line_count++];
+    if (line->valid && line->length == text->scratch_length
+        && memcmp(line->chars, text->scratch, text->scratch_length) == 0)
+    {
+        text->lines_cached += 1;
+    }
+    else
+    {
+        memcpy(line->chars, text->scratch, text->scratch_length);
+        line->length = text->scratch_length;
+        line->valid = 1;
+        text_rasterize(text, line);
+    }
+
+    text->scratch_length = 0;
+}
+
+// NOTE(annad): x, y are top-left in framebuffer rows, unlike tinyrend where
+// y grows up. Every glyph row of a line is one contiguous copy.
+void text_draw(TextOverlay *text, Screen *screen, int x, int y)
+{
+    int pitch = text_max_columns * text_glyph_size;
+    for (int i = 0; i < text->line_count; i += 1)
+    {
+        TextLine *line = &text->lines[i];
+        int width = line->length * text_glyph_size;
+        if (x + width > (int)screen->width)
+            width = screen->width - x;
+        if (width <= 0)
+            continue;
+
+        for (int r = 0; r < text_glyph_size; r += 1)
+        {
+            int row = y + i * text_glyph_size + r;
+            if (row < 0 || row >= (int)screen->height)
+                continue;
+            memcpy(screen->buffer + row * screen->width + x,
+                line->pixels + r * pitch, width * sizeof(u32));
+        }
+    }
+}
@@ -0,0 +1,47 @@
+/**
+ * File: platform_text.h
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 17:40:03
+ * Last Modified Date: 10/19/2026 17:40:03
+ */
+
+#pragma once
+
+const int text_glyph_size = 8;
+const int text_first_char = 32;
+const int text_glyph_count = 64; // NOTE(annad): ' ' .. '_', lowercase is folded.
+const int text_max_columns = 60; // NOTE(annad): 480 / 8
+const int text_max_lines = 16;
+
+struct TextLine
+{
+    char chars[text_max_columns];
+    int length;
+    int valid;
+
+    // NOTE(annad): Rasterized once, reused while chars stay the same.
+    u32 pixels[text_glyph_size * text_max_columns * text_glyph_size];
+};
+
+struct TextOverlay
+{
+    // NOTE(annad): Glyph g row r is 8 contiguous pixels at (g * 8 + r) * 8.
+    u32 atlas[text_glyph_count * text_glyph_size * text_glyph_size];
+
+    TextLine lines[text_max_lines];
+    int line_count;
+
+    char scratch[text_max_columns];
+    int scratch_length;
+
+    u32 lines_cached;
+    u32 lines_rasterized;
+};
+
+void text_init(TextOverlay *text, u32 color);
+void text_begin(TextOverlay *text);
+void text_str(TextOverlay *text, const char *str);
+void text_int(TextOverlay *text, int value);
+void text_float(TextOverlay *text, SceFloat32 value, int decimals);
+void text_newline(TextOverlay *text);
+void text_draw(TextOverlay *text, Screen *screen, int x, int y);
@@ -2,10 +2,133 @@
  * File: psp_asset.cpp
  * Author: github.com/annadostoevskaya
  * Date: 09/14/2023 23:55:00
- * Last Modified Date: 09/17/2023 02:11:07
+ * Last Modified Date: 10/19/2026 08:24:37
  */
 
 #include "platform_asset.h"
+#include "platform_lz4.h"
+#include "platform_archive.h"
+
+struct PspArchive
+{
+    Archive archive;
+    SceUID fhandler;
+};
+
+// NOTE(annad): Asset::ctx on the PSP, archive is optional.
+struct PspAssetContext
+{
+    SceUID fhandler;
+    PspArchive *archive;
+    bool archived;
+    int pending_slot; // NOTE(annad): Ring slot with an async read in flight.
+};
+
+// NOTE(annad): Reads one block and unpacks it into dst, only compressed
+// blocks go through staging. Returns the unpacked size, -1 on error.
+int psp_asset_unpack_block(Asset *asset, SceUID fhandler, u8 *dst)
+{
+    u32 tag = 0;
+    if (sceIoRead(fhandler, &tag, sizeof(tag)) != sizeof(tag))
+        return -1;
+
+    size_t packed = tag & ~lz4_block_stored;
+    size_t raw = asset->size - asset->uploaded;
+    if (raw > asset->packed_block_size)
+        raw = asset->packed_block_size;
+
+    if (tag & lz4_block_stored)
+    {
+        if (packed != raw || sceIoRead(fhandler, dst, packed) != (int)packed)
+            return -1;
+    }
+    else
+    {
+        if (packed > asset->staging_size 
+            || sceIoRead(fhandler, asset->staging, packed) != (int)packed)
+            return -1;
+        if (lz4_decompress((u8*)asset->staging, packed, dst, raw) != (int)raw)
+            return -1;
+    }
+
+    return (int)raw;
+}
+
+// NOTE(annad): Unpacks whole blocks straight into asset->data until about
+// budget bytes are produced.
+bool psp_asset_unpack(Asset *asset, SceUID fhandler, size_t budget)
+{
+    size_t produced = 0;
+    while (produced < budget && asset->uploaded < asset->size)
+    {
+        int raw = psp_asset_unpack_block(asset, fhandler, (u8*)(asset->data + asset->uploaded));
+        if (raw < 0)
+            return false;
+
+        asset->uploaded += raw;
+        produced += raw;
+    }
+
+    return true;
+}
+
+// NOTE(annad): Raw files are double buffered through the ring, the next
+// slot is read asynchronously while the consumer parses the current one.
+// Packed blocks are unpacked synchronously into slot 0, one per call.
+bool psp_asset_stream(Asset *asset, PspAssetContext *ctx)
+{
+    if (asset->uploaded == asset->size)
+        return true;
+
+    if (asset->packed_block_size != 0)
+    {
+        if (asset->packed_block_size > asset_stream_slot_size)
+            return false;
+
+        int raw = psp_asset_unpack_block(asset, ctx->fhandler, (u8*)asset->data);
+        if (raw < 0)
+            return false;
+
+        asset->uploaded += raw;
+        asset->stream(asset->stream_user, asset->data, raw);
+        return true;
+    }
+
+    if (ctx->pending_slot < 0)
+    {
+        ctx->pending_slot = 0;
+        size_t chunk_size = asset->size - asset->uploaded;
+        if (chunk_size > asset_stream_slot_size)
+            chunk_size = asset_stream_slot_size;
+        return sceIoReadAsync(ctx->fhandler, asset->data, chunk_size) >= 0;
+    }
+
+    SceInt64 read = 0;
+    int status = sceIoPollAsync(ctx->fhandler, &read);
+    if (status == 1)
+        return true; // NOTE(annad): Still in flight.
+    if (status < 0 || read <= 0)
+        return false;
+
+    int slot = ctx->pending_slot;
+    char *chunk = asset->data + slot * asset_stream_slot_size;
+    asset->uploaded += (size_t)read;
+    ctx->pending_slot = -1;
+    if (asset->uploaded < asset->size)
+    {
+        int next_slot = (slot + 1) % asset_stream_slots;
+        size_t chunk_size = asset->size - asset->uploaded;
+        if (chunk_size > asset_stream_slot_size)
+            chunk_size = asset_stream_slot_size;
+
+        if (sceIoReadAsync(ctx->fhandler, asset->data + next_slot * asset_stream_slot_size, chunk_size) < 0)
+            return false;
+        ctx->pending_slot = next_slot;
+    }
+
+    asset->stream(asset->stream_user, chunk, (size_t)read);
+    return true;
+}
 
 void psp_asset_processing(Asset *asset)
 {
@@ -27,32 +150,127 @@ void psp_asset_processing(Asset *asset)
                 break;
             }
 
-            SceIoStat filestat;
-            if (sceIoGetstat(asset->path, &filestat) < 0)
+            PspAssetContext *ctx = (PspAssetContext*)asset->ctx;
+            const ArchiveEntry *entry = NULL;
+            if (ctx->archive != NULL)
+                entry = archive_find(&ctx->archive->archive, asset->path);
+
+            bool maybe_packed = true;
+            if (entry != NULL)
             {
-                asset->state = Asset::STATE_UNDEFINED;
-                break;
+                // NOTE(annad): No stat/open/close, one seek in the shared handle.
+                ctx->archived = true;
+                ctx->fhandler = ctx->archive->fhandler;
+                asset->size = entry->size;
+                maybe_packed = (entry->flags & ARCHIVE_ENTRY_LZ4) != 0;
+                if (maybe_packed && asset->staging == NULL)
+                {
+                    asset->state = Asset::STATE_UNDEFINED;
+                    break;
+                }
+
+                if (sceIoLseek32(ctx->fhandler, entry->offset, PSP_SEEK_SET) != (int)entry->offset)
+                {
+                    asset->state = Asset::STATE_UNDEFINED;
+                    break;
+                }
+            }
+            else
+            {
+                SceIoStat filestat;
+                if (sceIoGetstat(asset->path, &filestat) < 0)
+                {
+                    asset->state = Asset::STATE_UNDEFINED;
+                    break;
+                }
+
+                ctx->archived = false;
+                asset->size = filestat.st_size;
+                ctx->fhandler = sceIoOpen(asset->path, PSP_O_RDONLY, 0777);
+                if (ctx->fhandler < 0)
+                {
+                    asset->state = Asset::STATE_UNDEFINED;
+                    break;
+                }
             }
 
-            asset->size = filestat.st_size;
-            SceUID *fhandler = (SceUID*)asset->ctx;
-            *fhandler = sceIoOpen(asset->path, PSP_O_RDONLY, 0777);
+            // NOTE(annad): Packed files are recognized by magic.
+            Lz4Header header;
+            if (maybe_packed && asset->staging != NULL && asset->size >= sizeof(header)
+                && sceIoRead(ctx->fhandler, &header, sizeof(header)) == sizeof(header))
+            {
+                if (header.magic == lz4_magic)
+                {
+                    // NOTE(annad): A damaged header fails the asset, reading
+                    // the packed bytes as raw data would hand back garbage.
+                    size_t packed_size = asset->size - sizeof(header);
+                    bool valid = header.block_size > 0
+                        && header.block_size <= asset->staging_size
+                        && header.raw_size > 0
+                        && header.block_count == (header.raw_size - 1) / header.block_size + 1
+                        && header.block_count <= packed_size / sizeof(u32);
+                    if (!valid)
+                    {
+                        if (!ctx->archived)
+                            sceIoClose(ctx->fhandler);
+                        ctx->fhandler = -1;
+                        asset->state = Asset::STATE_UNDEFINED;
+                        break;
+                    }
+
+                    asset->size = header.raw_size;
+                    asset->packed_block_size = header.block_size;
+                }
+                else
+                {
+                    sceIoLseek32(ctx->fhandler, -(int)sizeof(header), PSP_SEEK_CUR);
+                }
+            }
 
+            ctx->pending_slot = -1;
             asset->state = Asset::STATE_RESOLVED;
         } break;
 
         case Asset::STATE_UPLOADING:
         {
-            SceUID *fhandler = (SceUID*)asset->ctx;
+            PspAssetContext *ctx = (PspAssetContext*)asset->ctx;
             if (asset->data == NULL)
             {
                 asset->state = Asset::STATE_UNDEFINED;
                 break;
             }
 
-            void *cursor = (void*)(asset->data + asset->uploaded);
-            size_t chunk_size = KB(512); // TODO(annad): Calc optimal variant!
-            asset->uploaded += sceIoRead(*fhandler, cursor, chunk_size);
+            if (asset->stream != NULL)
+            {
+                if (!psp_asset_stream(asset, ctx))
+                {
+                    asset->state = Asset::STATE_UNDEFINED;
+                    break;
+                }
+            }
+            else if (asset->packed_block_size != 0)
+            {
+                if (!psp_asset_unpack(asset, ctx->fhandler, KB(512)))
+                {
+                    asset->state = Asset::STATE_UNDEFINED;
+                    break;
+                }
+            }
+            else
+            {
+                void *cursor = (void*)(asset->data + asset->uploaded);
+                size_t chunk_size = KB(512); // TODO(annad): Calc optimal variant!
+                if (chunk_size > asset->size - asset->uploaded)
+                    chunk_size = asset->size - asset->uploaded;
+
+                int read = sceIoRead(ctx->fhandler, cursor, chunk_size);
+                if (read <= 0 && chunk_size != 0)
+                {
+                    asset->state = Asset::STATE_UNDEFINED;
+                    break;
+                }
+                asset->uploaded += read;
+            }
 
             if (asset->size == asset->uploaded)
                 asset->state = Asset::STATE_UPLOADED;
@@ -60,12 +278,12 @@ void psp_asset_processing(Asset *asset)
 
         case Asset::STATE_COMPLETED:
         {
-            SceUID *fhandler = (SceUID*)asset->ctx;
-            if (sceIoClose(*fhandler) < 0)
+            PspAssetContext *ctx = (PspAssetContext*)asset->ctx;
+            asset->state = Asset::STATE_RELEASED;
+            if (!ctx->archived && sceIoClose(ctx->fhandler) < 0)
                 asset->state = Asset::STATE_UNDEFINED;
 
-            *fhandler = -1;
-            asset->state = Asset::STATE_RELEASED;
+            ctx->fhandler = -1;
         } break;
 
         default:
@@ -75,3 +293,50 @@ void psp_asset_processing(Asset *asset)
     }
 }
 
+
+// NOTE(annad): The archive stays open, TOC lives in arena.
+bool psp_archive_open(PspArchive *pak, const char *path, Arena *arena)
+{
+    pak->archive.entries = NULL;
+    pak->fhandler = sceIoOpen(path, PSP_O_RDONLY, 0777);
+    if (pak->fhandler < 0)
+        return false;
+
+    // NOTE(annad): The TOC has to fit in the file, and an empty one would be
+    // arena_alloc(0), which resets the arena offset.
+    int file_size = sceIoLseek32(pak->fhandler, 0, PSP_SEEK_END);
+    sceIoLseek32(pak->fhandler, 0, PSP_SEEK_SET);
+
+    ArchiveHeader *header = &pak->archive.header;
+    if (file_size < (int)sizeof(*header)
+        || sceIoRead(pak->fhandler, header, sizeof(*header)) != sizeof(*header)
+        || header->magic != archive_magic || header->version != archive_version
+        || header->entry_count == 0
+        || header->entry_count > (file_size - sizeof(*header)) / sizeof(ArchiveEntry))
+    {
+        sceIoClose(pak->fhandler);
+        pak->fhandler = -1;
+        return false;
+    }
+
+    size_t toc_size = header->entry_count * sizeof(ArchiveEntry);
+    pak->archive.entries = (ArchiveEntry*)arena_alloc(arena, toc_size);
+    if (pak->archive.entries == NULL
+        || sceIoRead(pak->fhandler, pak->archive.entries, toc_size) != (int)toc_size)
+    {
+        pak->archive.entries = NULL;
+        sceIoClose(pak->fhandler);
+        pak->fhandler = -1;
+        return false;
+    }
+
+    return true;
+}
+
+void psp_archive_close(PspArchive *pak)
+{
+    if (pak->fhandler >= 0)
+        sceIoClose(pak->fhandler);
+    pak->fhandler = -1;
+    pak->archive.entries = NULL;
+}
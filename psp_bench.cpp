@@ -0,0 +1,674 @@
+/**
+ * File: psp_bench.cpp
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 11:52:03
+ * Last Modified Date: 10/19/2026 08:23:45
+ */
+
+// NOTE(annad): Compiled only with -DBENCH_BUILD, runs once before the main
+// loop and prints results to stdout (psplink shell).
+
+u64 bench_tick()
+{
+    u64 tick = 0;
+    sceRtcGetCurrentTick(&tick);
+    return tick;
+}
+
+SceFloat32 bench_seconds(u64 start, u64 end)
+{
+    return (SceFloat32)(end - start) / (SceFloat32)sceRtcGetTickResolution();
+}
+
+u32 bench_rand_state = 0x2545F491;
+
+u32 bench_rand()
+{
+    // NOTE(annad): xorshift32, fixed seed so runs are comparable.
+    bench_rand_state ^= bench_rand_state << 13;
+    bench_rand_state ^= bench_rand_state >> 17;
+    bench_rand_state ^= bench_rand_state << 5;
+    return bench_rand_state;
+}
+
+void bench_lines(Screen *screen, Arena *arena)
+{
+    const int line_count = 20000;
+    Vec2i *points = (Vec2i*)arena_alloc(arena, 2 * line_count * sizeof(Vec2i));
+    if (points == NULL)
+        return;
+
+    for (int i = 0; i < 2 * line_count; i += 1)
+    {
+        points[i].x = bench_rand() % pspScreenWidth;
+        points[i].y = bench_rand() % pspScreenHeight;
+    }
+
+    u64 start = bench_tick();
+    for (int i = 0; i < line_count; i += 1)
+        tr_line(screen, points[i * 2 + 0], points[i * 2 + 1], 0xffffff);
+    SceFloat32 old_time = bench_seconds(start, bench_tick());
+
+    start = bench_tick();
+    tr_lines(screen, points, line_count, 0xffffff);
+    SceFloat32 new_time = bench_seconds(start, bench_tick());
+
+    printf("bench_lines: tr_line %.0f lines/s, tr_lines %.0f lines/s\n",
+        (SceFloat32)line_count / old_time, (SceFloat32)line_count / new_time);
+
+    // NOTE(annad): Endpoints up to a screen away on every side, clipped
+    // endpoints have to be on screen and on the original line, segments
+    // through the screen must not be rejected.
+    int failed = 0;
+    for (int i = 0; i < 2 * line_count; i += 1)
+    {
+        points[i].x = (int)(bench_rand() % (3 * screen->width)) - screen->width;
+        points[i].y = (int)(bench_rand() % (3 * screen->height)) - screen->height;
+    }
+
+    for (int i = 0; i < line_count; i += 1)
+    {
+        Vec2i a = points[i * 2 + 0];
+        Vec2i b = points[i * 2 + 1];
+        int x0 = a.x, y0 = a.y, x1 = b.x, y1 = b.y;
+        bool visible = tr_clip_line(screen, &x0, &y0, &x1, &y1);
+
+        Vec2i mid((a.x + b.x) / 2, (a.y + b.y) / 2);
+        bool crosses = (u32)mid.x < screen->width && (u32)mid.y < screen->height;
+        if (!visible)
+        {
+            failed += crosses;
+            continue;
+        }
+
+        int ends[2][2] = {{x0, y0}, {x1, y1}};
+        float length = std::sqrt((float)(b.x - a.x) * (b.x - a.x) + (float)(b.y - a.y) * (b.y - a.y));
+        for (int k = 0; k < 2; k += 1)
+        {
+            int x = ends[k][0];
+            int y = ends[k][1];
+            float cross = (float)(b.x - a.x) * (y - a.y) - (float)(b.y - a.y) * (x - a.x);
+            if ((u32)x >= screen->width || (u32)y >= screen->height
+                || std::abs(cross) > 1.5f * std::max(length, 1.0f))
+                failed += 1;
+        }
+    }
+
+    start = bench_tick();
+    tr_lines(screen, points, line_count, 0xffffff);
+    SceFloat32 clip_time = bench_seconds(start, bench_tick());
+
+    printf("bench_lines: off-screen tr_lines %.0f lines/s, clipping %s\n",
+        (SceFloat32)line_count / clip_time, (failed == 0) ? "[OK]" : "[FAILED]");
+}
+
+// NOTE(annad): Same replay as tools/frame_replay.cpp, checked on the device.
+void bench_frame_pacing()
+{
+    FrameReplay replay;
+    bool ok = frame_replay(&replay);
+    printf("bench_frame_pacing: steps %d late %d dropped %d overshoot %dus avg %.3fms p50 %.1fms p99 %.1fms %s\n",
+        (int)replay.steps, (int)replay.late, (int)replay.dropped, (int)replay.overshoot,
+        replay.avg_ms, replay.p50_ms, replay.p99_ms, ok ? "[OK]" : "[FAILED]");
+}
+
+char *bench_read_file(Arena *arena, const char *path, size_t *size)
+{
+    SceIoStat stat;
+    if (sceIoGetstat(path, &stat) < 0)
+        return NULL;
+
+    *size = stat.st_size;
+    char *data = (char*)arena_alloc(arena, *size);
+    SceUID fd = sceIoOpen(path, PSP_O_RDONLY, 0777);
+    if (data == NULL || fd < 0)
+        return NULL;
+
+    size_t read = sceIoRead(fd, data, *size);
+    sceIoClose(fd);
+    return (read == *size) ? data : NULL;
+}
+
+// NOTE(annad): User code runs on one core, so more workers can't make the
+// decode faster. The sweep only shows the job system's scheduling overhead
+// against 0 workers, where the main thread runs everything inline.
+void bench_level_load(Arena *arena)
+{
+    size_t obj_size = 0;
+    size_t bmp_size = 0;
+    char *obj = bench_read_file(arena, "./OBJ/AFRICAN_HEAD.OBJ", &obj_size);
+    char *bmp = bench_read_file(arena, "./OBJ/AFRICAN_HEAD_DIFFUSE.BMP", &bmp_size);
+    if (obj == NULL || bmp == NULL)
+    {
+        printf("bench_level_load: resources not found\n");
+        return;
+    }
+
+    Arena frame_arena = {};
+    frame_arena.size = KB(64);
+    frame_arena.memory = arena_alloc(arena, frame_arena.size);
+
+    static PspJobs jobs;
+    for (int workers = 0; workers <= 3; workers += 1)
+    {
+        size_t offset = arena->offset;
+        if (!psp_jobs_start(&jobs, &frame_arena, workers))
+            break;
+
+        LevelLoad level;
+        level.mesh.model = NULL;
+        level.obj_data = obj;
+        level.obj_size = obj_size;
+        level.bmp_data = (u8*)bmp;
+        level.bmp_size = bmp_size;
+
+        u64 start = bench_tick();
+        tr_level_load(&level, &jobs.system, 0, arena);
+        SceFloat32 time = bench_seconds(start, bench_tick());
+
+        psp_jobs_stop(&jobs);
+        delete level.mesh.model;
+        arena_reset(&frame_arena);
+        arena->offset = offset;
+
+        printf("bench_level_load: %d workers %.2fms (overhead, no scaling)\n", workers, time * 1000.0f);
+    }
+}
+
+// NOTE(annad): Bandwidth of the uncached framebuffer, column order like
+// tr_triangle versus tiles filled in cache and flushed row by row. Then
+// the head drawn both ways.
+void bench_tiles(Screen *screen, Arena *arena)
+{
+    const int frames = 30;
+    u64 start = bench_tick();
+    for (int frame = 0; frame < frames; frame += 1)
+        for (int x = 0; x < screen->width; x += 1)
+            for (int y = 0; y < screen->height; y += 1)
+                screen_set_color(screen, x, y, frame);
+    SceFloat32 direct_time = bench_seconds(start, bench_tick());
+
+    TileRenderer tiles;
+    if (!tr_tile_begin(&tiles, screen, arena, 1))
+        return;
+
+    start = bench_tick();
+    for (int frame = 0; frame < frames; frame += 1)
+    {
+        tiles.clear_color = frame;
+        tr_tile_end(&tiles);
+    }
+    SceFloat32 tile_time = bench_seconds(start, bench_tick());
+
+    SceFloat32 bytes = (SceFloat32)frames * screen->size * sizeof(u32);
+    printf("bench_tiles: direct %.1fMB/s, tiles %.1fMB/s\n",
+        bytes / direct_time / MB(1), bytes / tile_time / MB(1));
+
+    size_t obj_size = 0;
+    char *obj = bench_read_file(arena, "./OBJ/AFRICAN_HEAD.OBJ", &obj_size);
+    if (obj == NULL)
+    {
+        printf("bench_tiles: resources not found\n");
+        return;
+    }
+
+    Model *model = new Model(obj, obj_size);
+    float *zbuffer = (float*)arena_alloc(arena, screen->size * sizeof(float));
+    if (zbuffer == NULL)
+    {
+        delete model;
+        return;
+    }
+
+    SceFloat32 raster_time[2] = {};
+    for (int frame = 0; frame < frames; frame += 1)
+    {
+        size_t offset = arena->offset;
+        start = bench_tick();
+        if (frame % 2 == 0)
+        {
+            memory_zeroing(screen->buffer, screen->size);
+            for (u32 i = 0; i < screen->size; i += 1)
+                zbuffer[i] = -FLT_MAX;
+        }
+        else if (!tr_tile_begin(&tiles, screen, arena, model->nfaces()))
+        {
+            break;
+        }
+
+        for (int i = 0; i < model->nfaces(); i += 1)
+        {
+            std::vector<int> face = model->face(i);
+            Vec3f pts[3];
+            for (int j = 0; j < 3; j += 1)
+                pts[j] = world2screen(screen, model->vert(face[j]));
+
+            u32 color = 0xff000000 | (bench_rand() & 0xffffff);
+            if (frame % 2 == 0)
+                tr_triangle(screen, pts, zbuffer, color);
+            else
+                tr_tile_triangle(&tiles, pts, color);
+        }
+
+        if (frame % 2 != 0)
+            tr_tile_end(&tiles);
+        raster_time[frame % 2] += bench_seconds(start, bench_tick());
+        arena->offset = offset;
+    }
+
+    printf("bench_tiles: head direct %.2fms/frame, tiles %.2fms/frame\n",
+        raster_time[0] * 2000.0f / frames, raster_time[1] * 2000.0f / frames);
+    delete model;
+}
+
+// NOTE(annad): Head layers submitted back to front, the worst case for
+// the depth test, with and without the front to back sort.
+void bench_overdraw(Screen *screen, Arena *arena)
+{
+    size_t obj_size = 0;
+    char *obj = bench_read_file(arena, "./OBJ/AFRICAN_HEAD.OBJ", &obj_size);
+    if (obj == NULL)
+    {
+        printf("bench_overdraw: resources not found\n");
+        return;
+    }
+
+    const int layers = 4;
+    const int frames = 10;
+    Model *model = new Model(obj, obj_size);
+    for (int sort = 0; sort < 2; sort += 1)
+    {
+        TileRenderer tiles = {};
+        SceFloat32 time = 0.0f;
+        for (int frame = 0; frame < frames; frame += 1)
+        {
+            size_t offset = arena->offset;
+            u64 start = bench_tick();
+            if (!tr_tile_begin(&tiles, screen, arena, layers * model->nfaces()))
+                break;
+
+            tiles.sort = (sort != 0);
+            for (int layer = 0; layer < layers; layer += 1)
+            {
+                Vec3f shift(0.1f * layer, 0.05f * layer, 0.25f * layer);
+                for (int i = 0; i < model->nfaces(); i += 1)
+                {
+                    std::vector<int> face = model->face(i);
+                    Vec3f pts[3];
+                    for (int j = 0; j < 3; j += 1)
+                        pts[j] = world2screen(screen, model->vert(face[j]) + shift);
+                    tr_tile_triangle(&tiles, pts, 0xff000000 | (i * 2654435761u >> 8));
+                }
+            }
+
+            tr_tile_end(&tiles);
+            time += bench_seconds(start, bench_tick());
+            arena->offset = offset;
+        }
+
+        printf("bench_overdraw: sort %d, shaded %u, visible %u (%.2fx), %.2fms/frame\n",
+            sort, tiles.pixels_shaded, tiles.pixels_visible,
+            (SceFloat32)tiles.pixels_shaded / (SceFloat32)std::max(tiles.pixels_visible, 1u),
+            time * 1000.0f / frames);
+    }
+
+    delete model;
+}
+
+// NOTE(annad): Crowd of heads in a grid, one batch per frame. Reports the
+// largest crowd that still fits a 60 FPS frame.
+void bench_instances(Screen *screen, Arena *arena)
+{
+    size_t obj_size = 0;
+    char *obj = bench_read_file(arena, "./OBJ/AFRICAN_HEAD.OBJ", &obj_size);
+    if (obj == NULL)
+    {
+        printf("bench_instances: resources not found\n");
+        return;
+    }
+
+    const int max_instances = 32;
+    const int frames = 10;
+    TrMesh mesh;
+    tr_mesh_build(&mesh, new Model(obj, obj_size));
+
+    static TrInstance instances[max_instances];
+    int fits = 0;
+    for (int count = 1; count <= max_instances; count *= 2)
+    {
+        int side = 1;
+        while (side * side < count)
+            side += 1;
+
+        float scale = 1.0f / side;
+        for (int i = 0; i < count; i += 1)
+        {
+            Vec3f position(-1.0f + scale * (2 * (i % side) + 1), -1.0f + scale * (2 * (i / side) + 1), 0.0f);
+            instances[i].transform = tr_transform(position, 0.3f * i, scale);
+            instances[i].color = 0xff000000 | (bench_rand() & 0xffffff);
+        }
+
+        SceFloat32 time = 0.0f;
+        for (int frame = 0; frame < frames; frame += 1)
+        {
+            size_t offset = arena->offset;
+            u64 start = bench_tick();
+            TileRenderer tiles;
+            if (tr_tile_begin(&tiles, screen, arena, count * mesh.model->nfaces()))
+            {
+                tr_draw_instances(&tiles, &mesh, instances, count, Vec3f(0, 0, -1));
+                tr_tile_end(&tiles);
+            }
+            time += bench_seconds(start, bench_tick());
+            arena->offset = offset;
+        }
+
+        SceFloat32 frame_ms = time * 1000.0f / frames;
+        if (frame_ms <= 1000.0f / 60.0f)
+            fits = count;
+        printf("bench_instances: %d instances %.2fms/frame\n", count, frame_ms);
+    }
+
+    printf("bench_instances: %d instances per frame at 60 FPS\n", fits);
+    delete mesh.model;
+}
+
+// NOTE(annad): Float versus packed vertices: memory per mesh, transform
+// stage throughput and the quantization error against its bounds, which
+// are half a quantum for positions and uvs plus float rounding, and one
+// degree for 8 bit octahedral normals.
+void bench_vertex_formats(Arena *arena)
+{
+    size_t obj_size = 0;
+    char *obj = bench_read_file(arena, "./OBJ/AFRICAN_HEAD.OBJ", &obj_size);
+    if (obj == NULL)
+    {
+        printf("bench_vertex_formats: resources not found\n");
+        return;
+    }
+
+    TrMesh float_mesh;
+    tr_mesh_build(&float_mesh, new Model(obj, obj_size));
+    Model *model = float_mesh.model;
+    TrMesh packed_mesh = float_mesh;
+    tr_pack_vertices(&packed_mesh.packed, model);
+
+    const float quantum_bound = 0.55f;
+    const float normal_bound = std::cos(1.0f * 3.14159265f / 180.0f);
+    int failed = 0;
+    for (int i = 0; i < model->nverts(); i += 1)
+    {
+        const PackedVertex *v = &packed_mesh.packed.vertices[i];
+        Vec3f position = tr_unpack_position(&packed_mesh.packed, v);
+        for (int j = 0; j < 3; j += 1)
+        {
+            if (std::abs(position[j] - model->vert(i)[j]) > quantum_bound * packed_mesh.packed.scale[j] + 1e-6f)
+                failed += 1;
+        }
+
+        Vec2f uv = tr_unpack_uv(&packed_mesh.packed, v);
+        for (int j = 0; j < 2; j += 1)
+        {
+            if (std::abs(uv[j] - model->uv(i)[j]) > quantum_bound * packed_mesh.packed.uv_scale[j] + 1e-6f)
+                failed += 1;
+        }
+
+        Vec3f normal = model->normal(i);
+        if (normal * normal > 0.0f && tr_unpack_normal(v) * normal.normalize() < normal_bound)
+            failed += 1;
+    }
+
+    const int frames = 100;
+    Vec3f *out = (Vec3f*)arena_alloc(arena, float_mesh.vertex_count * sizeof(Vec3f));
+    if (out == NULL)
+    {
+        delete model;
+        return;
+    }
+
+    TrAffine to_screen = tr_affine(tr_transform(Vec3f(0, 0, 0), 0.5f, 1.0f));
+    SceFloat32 time[2] = {};
+    for (int layout = 0; layout < 2; layout += 1)
+    {
+        const TrMesh *mesh = (layout == 0) ? &float_mesh : &packed_mesh;
+        u64 start = bench_tick();
+        for (int frame = 0; frame < frames; frame += 1)
+            tr_transform_vertices(mesh, &to_screen, out);
+        time[layout] = bench_seconds(start, bench_tick());
+    }
+
+    SceFloat32 vertices = (SceFloat32)frames * float_mesh.vertex_count;
+    printf("bench_vertex_formats: float %d bytes %.0f vertices/s, packed %d bytes %.0f vertices/s, %s\n",
+        (int)(float_mesh.vertex_count * (2 * sizeof(Vec3f) + sizeof(Vec2f))), vertices / time[0],
+        (int)(float_mesh.vertex_count * sizeof(PackedVertex)), vertices / time[1],
+        (failed == 0) ? "error bounds [OK]" : "error bounds [FAILED]");
+
+    delete model;
+}
+
+// NOTE(annad): Typical debug frame, one changing line and seven static ones.
+void bench_text(Screen *screen)
+{
+    const int frames = 120;
+    static TextOverlay overlay;
+    text_init(&overlay, 0xffffffff);
+
+    u64 start = bench_tick();
+    for (int frame = 0; frame < frames; frame += 1)
+    {
+        text_begin(&overlay);
+        text_str(&overlay, "FPS: ");
+        text_float(&overlay, 59.94f - 0.01f * frame, 4);
+        text_newline(&overlay);
+        for (int i = 0; i < 7; i += 1)
+        {
+            text_str(&overlay, "ZONE ");
+            text_int(&overlay, i);
+            text_str(&overlay, ": AVG ");
+            text_float(&overlay, 1.25f * i, 3);
+            text_str(&overlay, " MS");
+            text_newline(&overlay);
+        }
+        text_draw(&overlay, screen, 0, 0);
+    }
+    SceFloat32 overlay_time = bench_seconds(start, bench_tick());
+
+    pspDebugScreenInitEx(screen->buffer, PSP_DISPLAY_PIXEL_FORMAT_8888, 0);
+    start = bench_tick();
+    for (int frame = 0; frame < frames; frame += 1)
+    {
+        pspDebugScreenSetBase(screen->buffer);
+        pspDebugScreenSetXY(0, 0);
+        pspDebugScreenPrintf("FPS: %.4f\n", 59.94f - 0.01f * frame);
+        for (int i = 0; i < 7; i += 1)
+            pspDebugScreenPrintf("ZONE %d: AVG %.3f MS\n", i, 1.25f * i);
+    }
+    SceFloat32 debug_time = bench_seconds(start, bench_tick());
+
+    printf("bench_text: overlay %.3fms/frame, pspDebugScreenPrintf %.3fms/frame\n",
+        overlay_time * 1000.0f / frames, debug_time * 1000.0f / frames);
+}
+
+// NOTE(annad): Drives the same state machines as gtick, peak memory is
+// what the load took from the arena, staging included.
+bool bench_asset_load(Arena *arena, const char *path, bool packed, PspArchive *archive = NULL, bool quiet = false)
+{
+    size_t offset = arena->offset;
+
+    PspAssetContext ctx = {};
+    ctx.fhandler = -1;
+    ctx.archive = archive;
+    Asset asset = {};
+    asset.ctx = &ctx;
+    asset.path = asset_path;
+    if (packed)
+    {
+        asset.staging_size = lz4_block_size;
+        asset.staging = (char*)arena_alloc(arena, asset.staging_size);
+    }
+
+    Resource res = {};
+    res.path = (char*)path;
+    res.state = Resource::STATE_INACTIVE;
+
+    u64 start = bench_tick();
+    while (asset.state != Asset::STATE_INACTIVE || res.state != Resource::STATE_COMPLETED)
+    {
+        asset_processing(&asset, &res, arena);
+        psp_asset_processing(&asset);
+        if (asset.state == Asset::STATE_UNDEFINED)
+            break;
+    }
+    SceFloat32 time = bench_seconds(start, bench_tick());
+
+    bool result = (res.state == Resource::STATE_COMPLETED);
+    if (!quiet && result)
+    {
+        printf("bench_asset_load: %s %.2fms, %d bytes, peak %d bytes\n",
+            path, time * 1000.0f, (int)res.size, (int)(arena->offset - offset));
+    }
+    else if (!quiet)
+    {
+        printf("bench_asset_load: %s [FAILED]\n", path);
+    }
+
+    arena->offset = offset;
+    return result;
+}
+
+// NOTE(annad): Upload then parse versus parse while uploading, the streamed
+// load only takes the ring from the arena.
+void bench_obj_stream(Arena *arena, const char *path, bool streamed)
+{
+    size_t offset = arena->offset;
+
+    PspAssetContext ctx = {};
+    ctx.fhandler = -1;
+    Asset asset = {};
+    asset.ctx = &ctx;
+    asset.path = asset_path;
+
+    Model *model = new Model();
+    ObjParser parser;
+    obj_parser_init(&parser, model);
+
+    Resource res = {};
+    res.path = (char*)path;
+    res.state = Resource::STATE_INACTIVE;
+    if (streamed)
+    {
+        res.stream = obj_stream;
+        res.stream_user = &parser;
+    }
+
+    u64 start = bench_tick();
+    while (asset.state != Asset::STATE_INACTIVE || res.state != Resource::STATE_COMPLETED)
+    {
+        asset_processing(&asset, &res, arena);
+        psp_asset_processing(&asset);
+        if (asset.state == Asset::STATE_UNDEFINED)
+            break;
+    }
+
+    if (!streamed && res.state == Resource::STATE_COMPLETED)
+        obj_parser_feed(&parser, res.data, res.size);
+    obj_parser_finish(&parser);
+    SceFloat32 time = bench_seconds(start, bench_tick());
+
+    printf("bench_obj_stream: %s %s %.2fms, %d faces, peak %d bytes\n",
+        path, streamed ? "streamed" : "whole", time * 1000.0f,
+        model->nfaces(), (int)(arena->offset - offset));
+
+    delete model;
+    arena->offset = offset;
+}
+
+// NOTE(annad): Needs 500 small files and their archive, made on the host:
+//   mkdir BENCH; for i in $(seq -w 0 499); do
+//     head -c $((RANDOM % 8192 + 1)) /dev/urandom > BENCH/A$i.BIN; done
+//   ./asset_archive BENCH.PAK BENCH/*.BIN
+void bench_archive(Arena *arena)
+{
+    const int asset_count = 500;
+    char path[asset_path_str_size];
+    write_str(path, sizeof(path), "./BENCH/A000.BIN");
+
+    u64 start = bench_tick();
+    int loaded = 0;
+    for (int i = 0; i < asset_count; i += 1)
+    {
+        path[9] = (char)('0' + i / 100);
+        path[10] = (char)('0' + i / 10 % 10);
+        path[11] = (char)('0' + i % 10);
+        loaded += bench_asset_load(arena, path, false, NULL, true);
+    }
+    SceFloat32 loose_time = bench_seconds(start, bench_tick());
+
+    size_t offset = arena->offset;
+    static PspArchive archive;
+    start = bench_tick();
+    if (!psp_archive_open(&archive, "./BENCH.PAK", arena))
+    {
+        printf("bench_archive: BENCH.PAK not found\n");
+        return;
+    }
+
+    // NOTE(annad): Requests go in TOC order, so reads are sequential.
+    static char *order[asset_count];
+    for (int i = 0; i < asset_count; i += 1)
+    {
+        order[i] = (char*)arena_alloc(arena, asset_path_str_size);
+        write_str(order[i], asset_path_str_size, "./BENCH/A000.BIN");
+        order[i][9] = (char)('0' + i / 100);
+        order[i][10] = (char)('0' + i / 10 % 10);
+        order[i][11] = (char)('0' + i % 10);
+    }
+    archive_sort_paths(&archive.archive, (const char**)order, asset_count);
+
+    int packed_loaded = 0;
+    for (int i = 0; i < asset_count; i += 1)
+        packed_loaded += bench_asset_load(arena, order[i], false, &archive, true);
+    SceFloat32 packed_time = bench_seconds(start, bench_tick());
+
+    psp_archive_close(&archive);
+    arena->offset = offset;
+
+    printf("bench_archive: loose %d assets %.2fms, packed %d assets %.2fms\n",
+        loaded, loose_time * 1000.0f, packed_loaded, packed_time * 1000.0f);
+}
+
+void psp_bench_run(Screen *screen, Arena *arena)
+{
+    size_t offset = arena->offset;
+
+    bench_lines(screen, arena);
+    arena->offset = offset;
+
+    bench_tiles(screen, arena);
+    arena->offset = offset;
+
+    bench_overdraw(screen, arena);
+    arena->offset = offset;
+
+    bench_instances(screen, arena);
+    arena->offset = offset;
+
+    bench_vertex_formats(arena);
+    arena->offset = offset;
+
+    bench_frame_pacing();
+    bench_text(screen);
+
+    bench_level_load(arena);
+    arena->offset = offset;
+
+    bench_asset_load(arena, "./OBJ/AFRICAN_HEAD.OBJ", false);
+    bench_asset_load(arena, "./OBJ/AFRICAN_HEAD.OBJ.LZ4", true);
+    bench_asset_load(arena, "./OBJ/AFRICAN_HEAD_DIFFUSE.BMP", false);
+    bench_asset_load(arena, "./OBJ/AFRICAN_HEAD_DIFFUSE.BMP.LZ4", true);
+
+    bench_obj_stream(arena, "./OBJ/AFRICAN_HEAD.OBJ", false);
+    bench_obj_stream(arena, "./OBJ/AFRICAN_HEAD.OBJ", true);
+
+    bench_archive(arena);
+}
@@ -0,0 +1,38 @@
+/**
+ * File: psp_frame.cpp
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 14:58:06
+ * Last Modified Date: 10/19/2026 14:58:06
+ */
+
+#include "platform_frame.h"
+
+u64 psp_frame_now(void *ctx)
+{
+    (void)ctx;
+    u64 tick = 0;
+    sceRtcGetCurrentTick(&tick);
+    return tick;
+}
+
+void psp_frame_sleep(void *ctx, u64 ticks)
+{
+    FrameClock *clock = (FrameClock*)ctx;
+    u64 us = ticks * 1000000 / clock->ticks_per_second;
+    sceKernelDelayThread((SceUInt)us);
+}
+
+void psp_frame_wait_vblank(void *ctx)
+{
+    (void)ctx;
+    sceDisplayWaitVblankStart();
+}
+
+void psp_frame_clock(FrameClock *clock)
+{
+    clock->ctx = clock;
+    clock->now = psp_frame_now;
+    clock->sleep = psp_frame_sleep;
+    clock->wait_vblank = psp_frame_wait_vblank;
+    clock->ticks_per_second = sceRtcGetTickResolution();
+}
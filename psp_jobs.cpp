@@ -0,0 +1,120 @@
+/**
+ * File: psp_jobs.cpp
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 16:10:29
+ * Last Modified Date: 10/19/2026 08:13:45
+ */
+
+#include "platform_jobs.h"
+
+// NOTE(annad): Allegrex is a single core for user code, the Media Engine
+// needs a kernel module to be driven. Workers are kernel threads here,
+// they make progress whenever the main thread blocks (I/O, vblank, idle).
+const int psp_job_workers = 1;
+// NOTE(annad): Below main (0x20), so a running job never delays the main
+// thread when its wait (vblank, I/O) ends.
+const int psp_job_thread_priority = 0x21;
+const int psp_job_stack_size = KB(64);
+
+struct PspJobs
+{
+    JobPlatform platform;
+    JobSystem system;
+    SceUID locks[job_lock_shared + 1];
+    SceUID wake;
+    SceUID threads[job_max_workers];
+};
+
+struct PspJobWorker
+{
+    JobSystem *system;
+    int thread;
+};
+
+void psp_jobs_lock(void *ctx, int id)
+{
+    PspJobs *psp = (PspJobs*)ctx;
+    sceKernelWaitSema(psp->locks[id], 1, NULL);
+}
+
+void psp_jobs_unlock(void *ctx, int id)
+{
+    PspJobs *psp = (PspJobs*)ctx;
+    sceKernelSignalSema(psp->locks[id], 1);
+}
+
+void psp_jobs_wake(void *ctx, int count)
+{
+    PspJobs *psp = (PspJobs*)ctx;
+    sceKernelSignalSema(psp->wake, count);
+}
+
+void psp_jobs_idle(void *ctx)
+{
+    PspJobs *psp = (PspJobs*)ctx;
+    // NOTE(annad): us, wakes are lossy by design, so an idle worker may
+    // pick up new work up to 1ms late.
+    SceUInt timeout = 1000;
+    sceKernelWaitSema(psp->wake, 1, &timeout);
+}
+
+int psp_jobs_worker(SceSize args, void *argp)
+{
+    (void)args;
+    PspJobWorker *worker = (PspJobWorker*)argp;
+    job_worker_loop(worker->system, worker->thread);
+    sceKernelExitThread(0);
+    return 0;
+}
+
+bool psp_jobs_start(PspJobs *psp, Arena *frame_arena, int worker_count)
+{
+    psp->platform.ctx = psp;
+    psp->platform.lock = psp_jobs_lock;
+    psp->platform.unlock = psp_jobs_unlock;
+    psp->platform.wake = psp_jobs_wake;
+    psp->platform.idle = psp_jobs_idle;
+
+    for (int i = 0; i < job_lock_shared + 1; i += 1)
+    {
+        psp->locks[i] = sceKernelCreateSema("job_lock", 0, 1, 1, NULL);
+        if (psp->locks[i] < 0)
+            return false;
+    }
+
+    psp->wake = sceKernelCreateSema("job_wake", 0, 0, 0x7fff, NULL);
+    if (psp->wake < 0)
+        return false;
+
+    job_system_init(&psp->system, &psp->platform, frame_arena, worker_count);
+    for (int i = 0; i < psp->system.worker_count; i += 1)
+    {
+        psp->threads[i] = sceKernelCreateThread("job_worker", psp_jobs_worker,
+            psp_job_thread_priority, psp_job_stack_size, THREAD_ATTR_USER | THREAD_ATTR_VFPU, NULL);
+        if (psp->threads[i] < 0)
+        {
+            psp->system.worker_count = i;
+            break;
+        }
+
+        // NOTE(annad): argp is copied onto the new thread stack.
+        PspJobWorker worker = { &psp->system, i + 1 };
+        sceKernelStartThread(psp->threads[i], sizeof(worker), &worker);
+    }
+
+    return true;
+}
+
+void psp_jobs_stop(PspJobs *psp)
+{
+    job_system_stop(&psp->system);
+    for (int i = 0; i < psp->system.worker_count; i += 1)
+    {
+        sceKernelWaitThreadEnd(psp->threads[i], NULL);
+        sceKernelDeleteThread(psp->threads[i]);
+    }
+
+    sceKernelDeleteSema(psp->wake);
+    for (int i = 0; i < job_lock_shared + 1; i += 1)
+        sceKernelDeleteSema(psp->locks[i]);
+}
@@ -2,7 +2,7 @@
  * File: psp_main.cpp
  * Author: github.com/annadostoevskaya
  * Date: 08/29/2023 21:38:27
- * Last Modified Date: 09/17/2023 02:29:33
+ * Last Modified Date: 10/19/2026 08:24:45
  */
 
 #include <pspkernel.h>
@@ -12,6 +12,7 @@
 #include <pspdisplay.h>
 #include <pspge.h>
 #include <psprtc.h>
+#include <pspctrl.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -33,13 +34,6 @@ void memory_zeroing(u32* memory, size_t size)
     while(size--) memory[size] = 0x0;
 }
 
-SceFloat32 psp_calcDeltaTime(u64 curTick, u64 lastTick)
-{
-    SceFloat32 tickres = (SceFloat32)(sceRtcGetTickResolution() / 1000);
-    u32 dtick = curTick - lastTick;
-    return (SceFloat32)dtick / tickres; // NOTE: tick / tick/ms -> ms
-}
-
 enum SCREEN_BUFFERS
 {
     SCREEN_BUFFER_FIRST = 0,
@@ -87,11 +81,22 @@ void arena_reset(Arena *arena)
 
 void write_str(char *dst_str, size_t dst_str_sz, const char *src_str)
 {
-    while (dst_str_sz-- && *src_str != '\0')
+    if (dst_str_sz == 0)
+        return;
+
+    while (--dst_str_sz && *src_str != '\0')
         *dst_str++ = *src_str++;
+    *dst_str = '\0';
 }
 
+#include "platform_lz4.cpp"
+#include "platform_archive.cpp"
 #include "platform_asset.cpp"
+#include "platform_text.cpp"
+#include "platform_profiler.cpp"
+#include "platform_frame.cpp"
+#include "platform_jobs.cpp"
+#include "tinyrend.cpp"
 
 struct Game
 {
@@ -99,23 +104,35 @@ struct Game
     {
         STATE_INIT = 0,
         STATE_UPLOAD_RES,
+        STATE_DECODE_RES,
         STATE_MAIN,
 
         STATE_COUNT
     } state;
 
     Asset *asset;
+    Archive *archive; // NOTE(annad): NULL when loading loose files.
+    JobSystem *jobs;
+    LevelLoad level;
+    ObjParser obj_parser;
+    bool level_ready;
+    float yaw;
+
+    bool wireframe; // NOTE(annad): Debug, toggled with SELECT.
+    std::vector<int> edges;
 };
 
 void gtick(Game *game, Screen *screen, Arena *arena, float dt)
 {
+    PROFILE_ZONE("gtick");
     (void)screen; 
-    (void)(dt);
 
     Asset *asset = game->asset;
 
     static Resource resources[2];
+    static int order[2]; // NOTE(annad): Upload order, indices into resources.
     static int curres_idx = 0;
+    const int resource_count = sizeof(resources) / sizeof(resources[0]);
 
     switch (game->state)
     {
@@ -126,17 +143,37 @@ void gtick(Game *game, Screen *screen, Arena *arena, float dt)
             write_str(resources[0].path, asset_path_str_size, "./OBJ/AFRICAN_HEAD.OBJ");
             resources[0].state = Resource::STATE_INACTIVE;
 
+            // NOTE(annad): The mesh is built while the file is still uploading.
+            game->level.mesh.model = new Model();
+            obj_parser_init(&game->obj_parser, game->level.mesh.model);
+            resources[0].stream = obj_stream;
+            resources[0].stream_user = &game->obj_parser;
+
             resources[1].path = (char*)arena_alloc(arena, asset_path_str_size);
             write_str(resources[1].path, asset_path_str_size, "./OBJ/AFRICAN_HEAD_DIFFUSE.BMP");
             resources[1].state = Resource::STATE_INACTIVE;
 
+            // NOTE(annad): Archived resources are requested in file order,
+            // so the reads go forward. Missing ones keep their place last.
+            const char *paths[resource_count];
+            for (int i = 0; i < resource_count; i += 1)
+                paths[i] = resources[i].path;
+            archive_sort_paths(game->archive, paths, resource_count);
+            for (int i = 0; i < resource_count; i += 1)
+            {
+                for (int j = 0; j < resource_count; j += 1)
+                {
+                    if (paths[i] == resources[j].path)
+                        order[i] = j;
+                }
+            }
+
             game->state = Game::STATE_UPLOAD_RES;
         } break;
 
         case Game::STATE_UPLOAD_RES:
         {
-            Resource *curres = &resources[curres_idx];
-            int resource_count = sizeof(resources) / sizeof(resources[0]);
+            Resource *curres = &resources[order[curres_idx]];
 
             asset_processing(asset, curres, arena);
 
@@ -156,8 +193,23 @@ void gtick(Game *game, Screen *screen, Arena *arena, float dt)
                 curres_idx += 1;
             }
 
-            if (curres_idx == (sizeof(resources) / sizeof(resources[0])))
-                game->state = Game::STATE_MAIN;
+            if (curres_idx == resource_count)
+                game->state = Game::STATE_DECODE_RES;
+        } break;
+
+        case Game::STATE_DECODE_RES:
+        {
+            LevelLoad *level = &game->level;
+            obj_parser_finish(&game->obj_parser);
+            level->obj_data = resources[0].data;
+            level->obj_size = resources[0].size;
+            level->bmp_data = (u8*)resources[1].data;
+            level->bmp_size = resources[1].size;
+            game->level_ready = tr_level_load(level, game->jobs, 0, arena);
+            if (!game->level_ready)
+                printf("Decoding resources: [FAILED]\n");
+
+            game->state = Game::STATE_MAIN;
         } break;
 
         case Game::STATE_MAIN:
@@ -174,25 +226,46 @@ void gtick(Game *game, Screen *screen, Arena *arena, float dt)
     }
 
     // game
+    game->yaw += 0.5f * dt;
 }
 
-#include "tinyrend.cpp"
-#include "psp_asset.cpp"
+// NOTE(annad): Returns false when nothing was drawn and the screen still
+// needs clearing, the tile renderer covers the whole screen otherwise.
+bool grender(Game *game, Screen *screen, Arena *frame_arena)
+{
+    if (!game->level_ready)
+        return false;
+
+    PROFILE_ZONE("render");
+    TileRenderer tiles;
+    if (!tr_tile_begin(&tiles, screen, frame_arena, game->level.mesh.model->nfaces()))
+        return false;
+
+    TrInstance instance;
+    instance.transform = tr_transform(Vec3f(0, 0, 0), game->yaw, 1.0f);
+    instance.color = 0xffffffff;
+    tr_draw_instances(&tiles, &game->level.mesh, &instance, 1, Vec3f(0, 0, -1));
+    if (!tr_tile_end(&tiles))
+        return false;
+
+    if (game->wireframe)
+    {
+        if (game->edges.empty())
+            tr_mesh_edges(&game->edges, game->level.mesh.model);
+        tr_draw_instance_edges(screen, frame_arena, &game->level.mesh, &instance, game->edges, 0xff00ff00);
+    }
 
-#define PROFILING_START(name) \
-        u64 profiler_StartTick ## name = 0; \
-        sceRtcGetCurrentTick(&profiler_StartTick ## name)
+    return true;
+}
 
-#define PROFILING_END(name) \
-        u64 profiler_EndTick ## name = 0; \
-        sceRtcGetCurrentTick(&profiler_EndTick ## name); \
-        SceFloat32 profiler_Delta ## name = \
-            (SceFloat32)(profiler_EndTick ## name - profiler_StartTick ## name) \
-            / (SceFloat32)(sceRtcGetTickResolution() / 1000); \
-        (void)(profiler_Delta ## name)
+#include "psp_asset.cpp"
+#include "psp_profiler.cpp"
+#include "psp_frame.cpp"
+#include "psp_jobs.cpp"
 
-#define PROFILING_PRINT(name) \
-        pspDebugScreenPrintf(#name ": %.4fms\n", profiler_Delta ## name)
+#if BENCH_BUILD
+#include "psp_bench.cpp"
+#endif
 
 int main(int argc, char *argv[])
 {
@@ -207,11 +280,6 @@ int main(int argc, char *argv[])
     if (arena.memory == NULL) return -1; // TODO(annad): Handling error! 
     memory_zeroing((u32*)arena.memory, arena.size / 4);
 
-    // init ticks
-    u64 curTick = 0;
-    u64 lastTick = 0;
-    SceFloat32 frameTime = 1000.0f / sceDisplayGetFramePerSec();
-    SceFloat32 deltaTime = frameTime;
 
     // init screen
     u32 *vram = (u32*)(0x40000000 | (u32)sceGeEdramGetAddr());
@@ -228,72 +296,136 @@ int main(int argc, char *argv[])
     screen.height = pspScreenHeight;
 
     Asset asset = {};
-    asset.ctx = arena_alloc(&arena, sizeof(SceUID));
+    static PspArchive archive;
+    PspAssetContext *asset_ctx = (PspAssetContext*)arena_alloc(&arena, sizeof(PspAssetContext));
+    asset_ctx->fhandler = -1;
+    asset_ctx->archive = psp_archive_open(&archive, "./DATA.PAK", &arena) ? &archive : NULL;
+    asset.ctx = asset_ctx;
     asset.data = NULL;
     asset.state = Asset::STATE_INACTIVE;
     asset.path = asset_path;
+    asset.staging_size = lz4_block_size;
+    asset.staging = (char*)arena_alloc(&arena, asset.staging_size);
+
+    // NOTE(annad): Jobs are allocated here, reset once per frame.
+    Arena frame_arena = {};
+    frame_arena.size = MB(1);
+    frame_arena.memory = arena_alloc(&arena, frame_arena.size);
+
+    static PspJobs jobs;
+    if (!psp_jobs_start(&jobs, &frame_arena, psp_job_workers)) return -1; // TODO(annad): Handling error! 
 
     Game game = {};
     game.state = Game::STATE_INIT;
     game.asset = &asset;
+    game.archive = asset_ctx->archive ? &archive.archive : NULL;
+    game.jobs = &jobs.system;
+
+#if PROFILER_ENABLED
+    profiler_init(&global_profiler, psp_profiler_clock, sceRtcGetTickResolution());
+#endif
 
-    PROFILING_START(DebugScreenInit);
-    pspDebugScreenInitEx(screen.buffer, PSP_DISPLAY_PIXEL_FORMAT_8888, 0);
-    PROFILING_END(DebugScreenInit);
+    static TextOverlay overlay;
+    text_init(&overlay, 0xffffffff);
+
+#if DEBUG_BUILD
+    sceCtrlSetSamplingCycle(0);
+    sceCtrlSetSamplingMode(PSP_CTRL_MODE_DIGITAL);
+    u32 buttons = 0;
+#endif
+
+#if BENCH_BUILD
+    psp_bench_run(&screen, &arena);
+#endif
+
+    // init frame pacing
+    FrameClock clock = {};
+    psp_frame_clock(&clock);
+    FrameScheduler scheduler = {};
+    frame_init(&scheduler, &clock, 60, sceDisplayGetFramePerSec());
 
     for (;;)
     {
-        PROFILING_START(GameLoop);
-        // rendering, switch buffer
-        sceDisplaySetFrameBuf((void*)screen.buffer, 
-            pspLineSize, 
-            PSP_DISPLAY_PIXEL_FORMAT_8888, 
-            PSP_DISPLAY_SETBUF_IMMEDIATE);
-
-        screen.buffer  = (screen.buffer != screenBuffers[SCREEN_BUFFER_FIRST])
-            ? screenBuffers[SCREEN_BUFFER_FIRST] 
-            : screenBuffers[SCREEN_BUFFER_SECOND];
+        u32 steps = frame_begin(&scheduler);
+        {
+            PROFILE_ZONE("frame");
+            // rendering, switch buffer
+            sceDisplaySetFrameBuf((void*)screen.buffer, 
+                pspLineSize, 
+                PSP_DISPLAY_PIXEL_FORMAT_8888, 
+                PSP_DISPLAY_SETBUF_IMMEDIATE);
 
-        PROFILING_START(ZeroingScreen);
-        memory_zeroing(screen.buffer, screen.size);
-        PROFILING_END(ZeroingScreen);
-        pspDebugScreenSetBase(screen.buffer);
-        pspDebugScreenSetXY(0, 0);
+            screen.buffer  = (screen.buffer != screenBuffers[SCREEN_BUFFER_FIRST])
+                ? screenBuffers[SCREEN_BUFFER_FIRST] 
+                : screenBuffers[SCREEN_BUFFER_SECOND];
 
+            text_begin(&overlay);
 
 #if DEBUG_BUILD
-        // pspDebugScreenPrintf("Hello\n");
-        SceFloat32 FPS = 1000.0f / deltaTime;
-        pspDebugScreenPrintf("FPS: %.4f\n", FPS);
-        // pspDebugScreenPrintf("frameTime: %f ms\n", frameTime);
-        pspDebugScreenPrintf("dt: %.4f ms\n", deltaTime);
-        // pspDebugScreenPrintf("delay: %fms\n", (SceFloat32)delay / 1000.0f);
+            SceFloat32 deltaTime = 1000.0f * (SceFloat32)scheduler.elapsed 
+                / (SceFloat32)clock.ticks_per_second;
+            SceFloat32 FPS = 1000.0f / deltaTime;
+            text_str(&overlay, "FPS: ");
+            text_float(&overlay, FPS, 4);
+            text_newline(&overlay);
+            text_str(&overlay, "DT: ");
+            text_float(&overlay, deltaTime, 4);
+            text_str(&overlay, " MS");
+            text_newline(&overlay);
+            text_str(&overlay, "P99: ");
+            text_float(&overlay, frame_percentile_ms(&scheduler, 99), 1);
+            text_str(&overlay, " MS LATE: ");
+            text_int(&overlay, (int)scheduler.late_frames);
+            text_str(&overlay, " DROPPED: ");
+            text_int(&overlay, (int)scheduler.dropped_steps);
+            text_newline(&overlay);
+#endif
+#if DEBUG_BUILD
+            SceCtrlData pad;
+            if (sceCtrlPeekBufferPositive(&pad, 1) > 0)
+            {
+                u32 pressed = pad.Buttons & ~buttons;
+                if (pressed & PSP_CTRL_SELECT)
+                    game.wireframe = !game.wireframe;
+                buttons = pad.Buttons;
+            }
 #endif
-        gtick(&game, &screen, &arena, 1.0f/60.0f);
-
-        // psp asset processing
-        psp_asset_processing(&asset);
-
-        PROFILING_END(GameLoop);
-        PROFILING_PRINT(GameLoop);
-        PROFILING_PRINT(ZeroingScreen);
-        PROFILING_PRINT(DebugScreenInit);
-
-        // tick
-        sceRtcGetCurrentTick(&curTick);
-        deltaTime = psp_calcDeltaTime(curTick, lastTick);
-        // FIXME(annad): Difficult bug in this part. FPU Exception!
-        SceFloat32 delay = (1000.0f * (frameTime - deltaTime));
-        if (delay > 0.0f)
+            for (u32 step = 0; step < steps; step += 1)
+                gtick(&game, &screen, &arena, scheduler.dt);
+
+            // psp asset processing
+            {
+                PROFILE_ZONE("asset_io");
+                psp_asset_processing(&asset);
+            }
+
+            if (!grender(&game, &screen, &frame_arena))
+            {
+                PROFILE_ZONE("zeroing_screen");
+                memory_zeroing(screen.buffer, screen.size);
+            }
+        }
+
         {
-            sceKernelDelayThread((u32)delay);
+            PROFILE_ZONE("text_overlay");
+#if PROFILER_ENABLED
+            profiler_print(&global_profiler, &overlay);
+#endif
+            text_draw(&overlay, &screen, 0, 0);
         }
 
-        sceRtcGetCurrentTick(&curTick);
-        deltaTime = psp_calcDeltaTime(curTick, lastTick);
-        lastTick = curTick;
+#if PROFILER_ENABLED
+        if (global_profiler.frame_count == (u32)profiler_history)
+            psp_profiler_export(&global_profiler, &arena, "host0:/trace.json");
+        profiler_frame(&global_profiler);
+#endif
+
+        arena_reset(&frame_arena);
+        frame_end(&scheduler);
     }
     
+    psp_jobs_stop(&jobs);
+    psp_archive_close(&archive);
     arena_reset(&arena);
     sceKernelFreePartitionMemory(block_id);
 
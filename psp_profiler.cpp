@@ -0,0 +1,37 @@
+/**
+ * File: psp_profiler.cpp
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 13:41:18
+ * Last Modified Date: 10/19/2026 07:49:14
+ */
+
+#include "platform_profiler.h"
+
+u64 psp_profiler_clock()
+{
+    u64 tick = 0;
+    sceRtcGetCurrentTick(&tick);
+    return tick;
+}
+
+// NOTE(annad): path is usually "host0:/trace.json" under psplink.
+bool psp_profiler_export(Profiler *profiler, Arena *arena, const char *path)
+{
+    size_t offset = arena->offset;
+    size_t size = KB(512);
+    char *json = (char*)arena_alloc(arena, size);
+    if (json == NULL)
+        return false;
+
+    size_t written = profiler_trace_json(profiler, json, size);
+    SceUID fd = sceIoOpen(path, PSP_O_WRONLY | PSP_O_CREAT | PSP_O_TRUNC, 0777);
+    bool result = false;
+    if (fd >= 0)
+    {
+        result = (sceIoWrite(fd, json, written) == (int)written);
+        sceIoClose(fd);
+    }
+
+    arena->offset = offset;
+    return result;
+}
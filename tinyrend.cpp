@@ -2,15 +2,21 @@
  * File: tinyrend.cpp
  * Author: github.com/annadostoevskaya
  * Date: 09/06/2023 22:19:00
- * Last Modified Date: 09/09/2023 01:31:02
+ * Last Modified Date: 10/19/2026 08:05:36
  */
 
 #include "tinyrend_geometry.h"
 
+u32 *screen_row(Screen *screen, int y)
+{
+    // NOTE(annad): y grows up, framebuffer rows grow down.
+    return screen->buffer + (screen->height - 1 - y) * screen->width;
+}
+
 void screen_set_color(Screen *screen, int x, int y, int color)
 {
-    if (y * screen->width + x < (int)screen->size)
-        screen->buffer[(screen->height - y) * screen->width + x] = color;
+    if ((u32)x < screen->width && (u32)y < screen->height)
+        screen_row(screen, y)[x] = color;
 }
 
 void tr_line(Screen *screen, Vec2i v1, Vec2i v2, int color)
@@ -107,7 +113,9 @@ void tr_triangle(Screen *screen, Vec3f *pts, float *zbuffer, int color)
     }
 }
 
+#include "tinyrend_obj.cpp"
 #include "tinyrend_model.cpp"
+#include "tinyrend_meshlet.cpp"
 
 Vec3f world2screen(Screen *s, Vec3f v) {
     return Vec3f(
@@ -117,34 +125,9 @@ Vec3f world2screen(Screen *s, Vec3f v) {
     );
 }
 
-void tiny_renderer_test(Screen *screen)
-{
-    Model *model = new Model("./OBJ/AFRICAN_HEAD.OBJ");
-    Vec3f light(0, 0, -1);
-    float *zbuffer = new float[screen->size];
-    for (int i = 0; i < model->nfaces(); i += 1)
-    {
-        std::vector face = model->face(i);
-        Vec3f world_coords[3];
-        Vec3f pts[3];
-        for (int j = 0; j < 3; j += 1) 
-        {
-            Vec3f v = model->vert(face[j]);
-            pts[j] = world2screen(screen, v);
-            world_coords[j] = v;
-        }
-        
-        Vec3f n = cross((world_coords[2] - world_coords[0]), (world_coords[1] - world_coords[0]));
-        n.normalize();
-        float intensity = n * light;
-        if (intensity > 0)
-        {
-            tr_triangle(screen, pts, zbuffer, 
-                (int)(intensity * 255.0f)
-                | (int)(intensity * 255.0f) << 8 
-                | (int)(intensity * 255.0f) << 16);
-        }
-    }
-
-    delete model;
-}
+#include "tinyrend_line.cpp"
+#include "tinyrend_bmp.cpp"
+#include "tinyrend_tile.cpp"
+#include "tinyrend_vertex.cpp"
+#include "tinyrend_instance.cpp"
+#include "tinyrend_load.cpp"
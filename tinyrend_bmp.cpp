@@ -0,0 +1,56 @@
+/**
+ * File: tinyrend_bmp.cpp
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 16:37:15
+ * Last Modified Date: 10/19/2026 16:37:15
+ */
+
+#include "tinyrend_bmp.h"
+
+u32 bmp_read_u32(const u8 *p)
+{
+    return (u32)p[0] | (u32)p[1] << 8 | (u32)p[2] << 16 | (u32)p[3] << 24;
+}
+
+u16 bmp_read_u16(const u8 *p)
+{
+    return (u16)(p[0] | p[1] << 8);
+}
+
+// NOTE(annad): Uncompressed 24/32 bpp only, that's what the exporter writes.
+bool tr_bmp_info(BmpInfo *info, const u8 *data, size_t size)
+{
+    if (size < 54 || data[0] != 'B' || data[1] != 'M')
+        return false;
+
+    u32 compression = bmp_read_u32(data + 30);
+    int height = (int)bmp_read_u32(data + 22);
+
+    info->offset = bmp_read_u32(data + 10);
+    info->width = (int)bmp_read_u32(data + 18);
+    info->height = (height < 0) ? -height : height;
+    info->top_down = (height < 0);
+    info->bpp = bmp_read_u16(data + 28);
+    info->pitch = ((size_t)info->width * info->bpp / 8 + 3) & ~(size_t)3;
+
+    if ((info->bpp != 24 && info->bpp != 32) || (compression != 0 && compression != 3))
+        return false;
+    if (info->width <= 0 || info->offset + info->pitch * info->height > size)
+        return false;
+    return true;
+}
+
+// NOTE(annad): Decodes rows [row_begin, row_end), independent ranges can
+// be decoded in parallel.
+void tr_bmp_decode_rows(Texture *texture, const BmpInfo *info, const u8 *data, int row_begin, int row_end)
+{
+    int bytes = info->bpp / 8;
+    for (int y = row_begin; y < row_end; y += 1)
+    {
+        int src_row = info->top_down ? (info->height - 1 - y) : y;
+        const u8 *src = data + info->offset + (size_t)src_row * info->pitch;
+        u32 *dst = texture->pixels + (size_t)y * texture->width;
+        for (int x = 0; x < info->width; x += 1, src += bytes)
+            dst[x] = 0xff000000 | (u32)src[0] << 16 | (u32)src[1] << 8 | (u32)src[2];
+    }
+}
@@ -0,0 +1,30 @@
+/**
+ * File: tinyrend_bmp.h
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 16:37:15
+ * Last Modified Date: 10/19/2026 16:37:15
+ */
+
+#pragma once
+
+// NOTE(annad): Pixels in PSP 8888 order (0xAABBGGRR), row 0 is the bottom
+// row so v = 0 of OBJ texture coordinates maps to it.
+struct Texture
+{
+    u32 *pixels;
+    int width;
+    int height;
+};
+
+struct BmpInfo
+{
+    int width;
+    int height;
+    int bpp;
+    bool top_down;
+    size_t offset;
+    size_t pitch;
+};
+
+bool tr_bmp_info(BmpInfo *info, const u8 *data, size_t size);
+void tr_bmp_decode_rows(Texture *texture, const BmpInfo *info, const u8 *data, int row_begin, int row_end);
@@ -0,0 +1,222 @@
+/**
+ * File: tinyrend_instance.cpp
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 22:48:31
+ * Last Modified Date: 10/19/2026 08:26:14
+ */
+
+#include "tinyrend_instance.h"
+
+void tr_mesh_build(TrMesh *mesh, Model *model)
+{
+    mesh->model = model;
+    mesh->vertex_count = model->nverts();
+    mesh->packed.vertices.clear();
+    tr_model_optimize(model);
+    tr_build_meshlets(&mesh->meshlets, model);
+
+    mesh->normals.resize(mesh->meshlets.triangles.size() / 3);
+    for (size_t m = 0; m < mesh->meshlets.meshlets.size(); m += 1)
+    {
+        const Meshlet *meshlet = &mesh->meshlets.meshlets[m];
+        const int *vertices = &mesh->meshlets.vertices[meshlet->vertex_offset];
+        const unsigned char *triangles = &mesh->meshlets.triangles[meshlet->triangle_offset * 3];
+        for (int i = 0; i < meshlet->triangle_count; i += 1)
+        {
+            Vec3f v0 = model->vert(vertices[triangles[i * 3 + 0]]);
+            Vec3f v1 = model->vert(vertices[triangles[i * 3 + 1]]);
+            Vec3f v2 = model->vert(vertices[triangles[i * 3 + 2]]);
+            // NOTE(annad): Degenerate triangles get a zero normal, never lit.
+            Vec3f n = cross(v2 - v0, v1 - v0);
+            float length = n.norm();
+            n = (length > 1e-12f) ? n * (1.0f / length) : Vec3f(0, 0, 0);
+            mesh->normals[meshlet->triangle_offset + i] = n;
+        }
+    }
+}
+
+// NOTE(annad): Switches the mesh to the compact layout, after
+// tr_mesh_build since meshlet bounds and normals need float positions.
+void tr_mesh_pack(TrMesh *mesh)
+{
+    tr_pack_vertices(&mesh->packed, mesh->model);
+    mesh->model->clear_verts();
+}
+
+// NOTE(annad): Rotation around y, then scale, then translation.
+Matrix tr_transform(Vec3f translation, float yaw, float scale)
+{
+    float c = std::cos(yaw) * scale;
+    float s = std::sin(yaw) * scale;
+    Matrix result = Matrix::identity();
+    result[0][0] = c;
+    result[0][2] = s;
+    result[2][0] = -s;
+    result[2][2] = c;
+    result[1][1] = scale;
+    for (int i = 0; i < 3; i += 1)
+        result[i][3] = translation[i];
+    return result;
+}
+
+// NOTE(annad): Affine part of a transform, rows of a 3x4 matrix.
+struct TrAffine
+{
+    float m[3][4];
+};
+
+TrAffine tr_affine(const Matrix &transform)
+{
+    TrAffine result;
+    for (int i = 0; i < 3; i += 1)
+        for (int j = 0; j < 4; j += 1)
+            result.m[i][j] = transform[i][j];
+    return result;
+}
+
+Vec3f tr_affine_point(const TrAffine *a, Vec3f v)
+{
+    return Vec3f(
+        a->m[0][0] * v.x + a->m[0][1] * v.y + a->m[0][2] * v.z + a->m[0][3],
+        a->m[1][0] * v.x + a->m[1][1] * v.y + a->m[1][2] * v.z + a->m[1][3],
+        a->m[2][0] * v.x + a->m[2][1] * v.y + a->m[2][2] * v.z + a->m[2][3]);
+}
+
+Vec3f tr_affine_dir(const TrAffine *a, Vec3f v)
+{
+    return Vec3f(
+        a->m[0][0] * v.x + a->m[0][1] * v.y + a->m[0][2] * v.z,
+        a->m[1][0] * v.x + a->m[1][1] * v.y + a->m[1][2] * v.z,
+        a->m[2][0] * v.x + a->m[2][1] * v.y + a->m[2][2] * v.z);
+}
+
+// NOTE(annad): world2screen folded into the transform, without rounding.
+TrAffine tr_affine_screen(Screen *screen, const Matrix &transform)
+{
+    Matrix viewport = Matrix::identity();
+    viewport[0][0] = viewport[0][3] = screen->width / 2.0f;
+    viewport[1][1] = viewport[1][3] = screen->height / 2.0f;
+    viewport[0][3] -= 0.5f;
+    viewport[1][3] -= 0.5f;
+    return tr_affine(viewport * transform);
+}
+
+// NOTE(annad): The batched transform stage, packed positions are decoded
+// by folding offset and scale into the matrix, so they cost a conversion
+// from u16 per component.
+void tr_transform_vertices(const TrMesh *mesh, const TrAffine *to_screen, Vec3f *out)
+{
+    if (mesh->packed.vertices.empty())
+    {
+        for (int i = 0; i < mesh->vertex_count; i += 1)
+            out[i] = tr_affine_point(to_screen, mesh->model->vert(i));
+        return;
+    }
+
+    TrAffine a = *to_screen;
+    for (int i = 0; i < 3; i += 1)
+    {
+        for (int j = 0; j < 3; j += 1)
+        {
+            a.m[i][3] += a.m[i][j] * mesh->packed.offset[j];
+            a.m[i][j] *= mesh->packed.scale[j];
+        }
+    }
+
+    const PackedVertex *vertices = &mesh->packed.vertices[0];
+    for (int i = 0; i < mesh->vertex_count; i += 1)
+    {
+        const u16 *p = vertices[i].position;
+        out[i] = tr_affine_point(&a, Vec3f(p[0], p[1], p[2]));
+    }
+}
+
+// NOTE(annad): Instances of one mesh go in a batch, per instance setup is
+// a few dot products and the vertices are transformed in one linear pass
+// into a scratch buffer reused by every instance. Meshlets are culled and
+// faces lit in object space, so face normals are never transformed.
+// Returns the number of triangles submitted to tiles.
+int tr_draw_instances(TileRenderer *tiles, const TrMesh *mesh, 
+    const TrInstance *instances, int instance_count, Vec3f light)
+{
+    PROFILE_ZONE("draw_instances");
+    Screen *screen = tiles->screen;
+    Vec3f *screen_verts = (Vec3f*)arena_alloc(tiles->arena, mesh->vertex_count * sizeof(Vec3f));
+    if (screen_verts == NULL)
+        return 0;
+
+    int submitted = 0;
+    for (int n = 0; n < instance_count; n += 1)
+    {
+        const TrInstance *instance = &instances[n];
+        TrAffine world = tr_affine(instance->transform);
+        TrAffine to_screen = tr_affine_screen(screen, instance->transform);
+
+        // NOTE(annad): Inverse rotation is the transpose once the scale is out.
+        Vec3f column(world.m[0][0], world.m[1][0], world.m[2][0]);
+        float scale = std::sqrt(column * column);
+        Vec3f object_light(
+            world.m[0][0] * light.x + world.m[1][0] * light.y + world.m[2][0] * light.z,
+            world.m[0][1] * light.x + world.m[1][1] * light.y + world.m[2][1] * light.z,
+            world.m[0][2] * light.x + world.m[1][2] * light.y + world.m[2][2] * light.z);
+        object_light = object_light / scale;
+
+        tr_transform_vertices(mesh, &to_screen, screen_verts);
+
+        u32 r = instance->color & 0xff;
+        u32 g = (instance->color >> 8) & 0xff;
+        u32 b = (instance->color >> 16) & 0xff;
+        for (size_t m = 0; m < mesh->meshlets.meshlets.size(); m += 1)
+        {
+            const Meshlet *meshlet = &mesh->meshlets.meshlets[m];
+            if (tr_meshlet_backfacing(meshlet, object_light))
+                continue;
+
+            Meshlet bounds = *meshlet;
+            bounds.center = tr_affine_point(&world, meshlet->center);
+            bounds.radius = meshlet->radius * scale;
+            if (tr_meshlet_outside(&bounds))
+                continue;
+
+            const int *vertices = &mesh->meshlets.vertices[meshlet->vertex_offset];
+            const unsigned char *triangles = &mesh->meshlets.triangles[meshlet->triangle_offset * 3];
+            const Vec3f *normals = &mesh->normals[meshlet->triangle_offset];
+            for (int i = 0; i < meshlet->triangle_count; i += 1)
+            {
+                float intensity = normals[i] * object_light;
+                if (!(intensity > 0)) // NOTE(annad): Also skips NaN.
+                    continue;
+
+                Vec3f pts[3];
+                for (int j = 0; j < 3; j += 1)
+                    pts[j] = screen_verts[vertices[triangles[i * 3 + j]]];
+
+                u32 level = (u32)(std::min(intensity, 1.0f) * 256.0f);
+                u32 color = (instance->color & 0xff000000)
+                    | (std::min(r * level >> 8, 255u))
+                    | (std::min(g * level >> 8, 255u) << 8)
+                    | (std::min(b * level >> 8, 255u) << 16);
+                if (!tr_tile_triangle(tiles, pts, color))
+                    return submitted;
+                submitted += 1;
+            }
+        }
+    }
+
+    return submitted;
+}
+
+// NOTE(annad): Debug overlay, draws straight into the screen after the
+// tile pass. Edges come from tr_mesh_edges.
+void tr_draw_instance_edges(Screen *screen, Arena *arena, const TrMesh *mesh,
+    const TrInstance *instance, const std::vector<int> &edges, u32 color)
+{
+    PROFILE_ZONE("draw_edges");
+    Vec3f *screen_verts = (Vec3f*)arena_alloc(arena, mesh->vertex_count * sizeof(Vec3f));
+    if (screen_verts == NULL)
+        return;
+
+    TrAffine to_screen = tr_affine_screen(screen, instance->transform);
+    tr_transform_vertices(mesh, &to_screen, screen_verts);
+    tr_wireframe(screen, screen_verts, edges, color);
+}
@@ -0,0 +1,37 @@
+/**
+ * File: tinyrend_instance.h
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 22:48:31
+ * Last Modified Date: 10/19/2026 08:12:43
+ */
+
+#pragma once
+
+// NOTE(annad): Mesh data shared by every instance, built once per model.
+struct TrMesh
+{
+    Model *model;
+    MeshletMesh meshlets;
+    std::vector<Vec3f> normals; // NOTE(annad): Per meshlet triangle, object space.
+    int vertex_count;
+
+    // NOTE(annad): Filled by tr_mesh_pack, model vertices are freed then.
+    PackedVertices packed;
+};
+
+// NOTE(annad): transform maps object space into the [-1, 1] cube that
+// world2screen expects. Rotation, uniform scale and translation only,
+// culling and lighting rely on it.
+struct TrInstance
+{
+    Matrix transform;
+    u32 color;
+};
+
+void tr_mesh_build(TrMesh *mesh, Model *model);
+void tr_mesh_pack(TrMesh *mesh);
+Matrix tr_transform(Vec3f translation, float yaw, float scale);
+void tr_draw_instance_edges(Screen *screen, Arena *arena, const TrMesh *mesh,
+    const TrInstance *instance, const std::vector<int> &edges, u32 color);
+int tr_draw_instances(TileRenderer *tiles, const TrMesh *mesh, 
+    const TrInstance *instances, int instance_count, Vec3f light);
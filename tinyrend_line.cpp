@@ -0,0 +1,251 @@
+/**
+ * File: tinyrend_line.cpp
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 11:14:36
+ * Last Modified Date: 10/19/2026 08:26:03
+ */
+
+#include <algorithm>
+
+enum
+{
+    CLIP_INSIDE = 0,
+    CLIP_LEFT   = 1 << 0,
+    CLIP_RIGHT  = 1 << 1,
+    CLIP_BOTTOM = 1 << 2,
+    CLIP_TOP    = 1 << 3
+};
+
+int clip_outcode(int x, int y, int xmax, int ymax)
+{
+    int code = CLIP_INSIDE;
+    if (x < 0)         code |= CLIP_LEFT;
+    else if (x > xmax) code |= CLIP_RIGHT;
+    if (y < 0)         code |= CLIP_BOTTOM;
+    else if (y > ymax) code |= CLIP_TOP;
+    return code;
+}
+
+// NOTE(annad): Cohen-Sutherland against [0, width-1]x[0, height-1].
+bool tr_clip_line(Screen *screen, int *x0, int *y0, int *x1, int *y1)
+{
+    int xmax = screen->width - 1;
+    int ymax = screen->height - 1;
+    int code0 = clip_outcode(*x0, *y0, xmax, ymax);
+    int code1 = clip_outcode(*x1, *y1, xmax, ymax);
+
+    for (;;)
+    {
+        if ((code0 | code1) == 0)
+            return true;
+        if (code0 & code1)
+            return false;
+
+        int code = code0 ? code0 : code1;
+        long long dx = *x1 - *x0;
+        long long dy = *y1 - *y0;
+        int x = 0;
+        int y = 0;
+        if (code & CLIP_TOP)
+        {
+            x = *x0 + (int)(dx * (ymax - *y0) / dy);
+            y = ymax;
+        }
+        else if (code & CLIP_BOTTOM)
+        {
+            x = *x0 + (int)(dx * (0 - *y0) / dy);
+            y = 0;
+        }
+        else if (code & CLIP_RIGHT)
+        {
+            y = *y0 + (int)(dy * (xmax - *x0) / dx);
+            x = xmax;
+        }
+        else
+        {
+            y = *y0 + (int)(dy * (0 - *x0) / dx);
+            x = 0;
+        }
+
+        if (code == code0)
+        {
+            *x0 = x;
+            *y0 = y;
+            code0 = clip_outcode(x, y, xmax, ymax);
+        }
+        else
+        {
+            *x1 = x;
+            *y1 = y;
+            code1 = clip_outcode(x, y, xmax, ymax);
+        }
+    }
+}
+
+// NOTE(annad): Expects already clipped endpoints, both are drawn.
+void tr_line_clipped(Screen *screen, int x0, int y0, int x1, int y1, u32 color)
+{
+    int pitch = screen->width;
+
+    if (y0 == y1)
+    {
+        if (x0 > x1)
+            std::swap(x0, x1);
+        u32 *p = screen_row(screen, y0) + x0;
+        for (int n = x1 - x0 + 1; n > 0; n -= 1)
+            *p++ = color;
+        return;
+    }
+
+    if (x0 == x1)
+    {
+        if (y0 > y1)
+            std::swap(y0, y1);
+        u32 *p = screen_row(screen, y0) + x0;
+        for (int n = y1 - y0 + 1; n > 0; n -= 1, p -= pitch)
+            *p = color;
+        return;
+    }
+
+    int dx = std::abs(x1 - x0);
+    int dy = std::abs(y1 - y0);
+
+    if (dx >= dy)
+    {
+        if (x0 > x1)
+        {
+            std::swap(x0, x1);
+            std::swap(y0, y1);
+        }
+
+        // NOTE(annad): Rows are flipped, going up in y is going back in memory.
+        int step = (y1 > y0) ? -pitch : pitch;
+        u32 *p = screen_row(screen, y0) + x0;
+        int error = -dx;
+        for (int n = dx + 1; n > 0; n -= 1)
+        {
+            *p++ = color;
+            error += 2 * dy;
+            int mask = ~(error >> 31); // NOTE(annad): -1 if error >= 0
+            p += step & mask;
+            error -= (2 * dx) & mask;
+        }
+    }
+    else
+    {
+        if (y0 > y1)
+        {
+            std::swap(x0, x1);
+            std::swap(y0, y1);
+        }
+
+        int step = (x1 > x0) ? 1 : -1;
+        u32 *p = screen_row(screen, y0) + x0;
+        int error = -dy;
+        for (int n = dy + 1; n > 0; n -= 1)
+        {
+            *p = color;
+            p -= pitch;
+            error += 2 * dx;
+            int mask = ~(error >> 31);
+            p += step & mask;
+            error -= (2 * dy) & mask;
+        }
+    }
+}
+
+// NOTE(annad): points holds 2 * line_count endpoints.
+void tr_lines(Screen *screen, const Vec2i *points, int line_count, u32 color)
+{
+    for (int i = 0; i < line_count; i += 1)
+    {
+        int x0 = points[i * 2 + 0].x;
+        int y0 = points[i * 2 + 0].y;
+        int x1 = points[i * 2 + 1].x;
+        int y1 = points[i * 2 + 1].y;
+        if (tr_clip_line(screen, &x0, &y0, &x1, &y1))
+            tr_line_clipped(screen, x0, y0, x1, y1, color);
+    }
+}
+
+struct EdgeVertex
+{
+    Vec3f position;
+    int index;
+};
+
+bool edge_vertex_less(const EdgeVertex &a, const EdgeVertex &b)
+{
+    if (a.position.x != b.position.x) return a.position.x < b.position.x;
+    if (a.position.y != b.position.y) return a.position.y < b.position.y;
+    if (a.position.z != b.position.z) return a.position.z < b.position.z;
+    return a.index < b.index;
+}
+
+// NOTE(annad): Unique edges of the face list, 2 vertex indices per edge.
+// Model vertices are v/vt/vn triples, both sides of a uv or normal seam
+// sit at the same position, so edges are keyed on the lowest vertex index
+// at each position and a seam edge is drawn once.
+void tr_mesh_edges(std::vector<int> *edges, Model *model)
+{
+    int vertex_count = model->nverts();
+    std::vector<EdgeVertex> sorted(vertex_count);
+    for (int i = 0; i < vertex_count; i += 1)
+    {
+        sorted[i].position = model->vert(i);
+        sorted[i].index = i;
+    }
+    std::sort(sorted.begin(), sorted.end(), edge_vertex_less);
+
+    std::vector<int> welded(vertex_count);
+    int first = 0;
+    for (int i = 0; i < vertex_count; i += 1)
+    {
+        Vec3f p = sorted[i].position;
+        Vec3f q = sorted[first].position;
+        if (p.x != q.x || p.y != q.y || p.z != q.z)
+            first = i;
+        welded[sorted[i].index] = sorted[first].index;
+    }
+
+    std::vector<int> indices = model->indices();
+    std::vector<unsigned long long> keys;
+    keys.reserve(indices.size());
+    for (size_t t = 0; t + 2 < indices.size(); t += 3)
+    {
+        for (int k = 0; k < 3; k += 1)
+        {
+            unsigned int a = welded[indices[t + k]];
+            unsigned int b = welded[indices[t + (k + 1) % 3]];
+            if (a == b)
+                continue; // NOTE(annad): Collapsed edge, nothing to draw.
+            if (a > b)
+                std::swap(a, b);
+            keys.push_back(((unsigned long long)a << 32) | b);
+        }
+    }
+
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    edges->resize(keys.size() * 2);
+    for (size_t i = 0; i < keys.size(); i += 1)
+    {
+        (*edges)[i * 2 + 0] = (int)(keys[i] >> 32);
+        (*edges)[i * 2 + 1] = (int)(keys[i] & 0xffffffff);
+    }
+}
+
+// NOTE(annad): verts are screen positions, tr_transform_vertices output.
+void tr_wireframe(Screen *screen, const Vec3f *verts, const std::vector<int> &edges, u32 color)
+{
+    for (size_t i = 0; i + 1 < edges.size(); i += 2)
+    {
+        int x0 = (int)verts[edges[i + 0]].x;
+        int y0 = (int)verts[edges[i + 0]].y;
+        int x1 = (int)verts[edges[i + 1]].x;
+        int y1 = (int)verts[edges[i + 1]].y;
+        if (tr_clip_line(screen, &x0, &y0, &x1, &y1))
+            tr_line_clipped(screen, x0, y0, x1, y1, color);
+    }
+}
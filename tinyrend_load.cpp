@@ -0,0 +1,111 @@
+/**
+ * File: tinyrend_load.cpp
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 16:52:40
+ * Last Modified Date: 10/19/2026 08:13:45
+ */
+
+// NOTE(annad): Decoding of uploaded level resources on the job system.
+const int level_bmp_bands = 8;
+const bool level_pack_vertices = true;
+
+struct LevelLoad
+{
+    const char *obj_data;
+    size_t obj_size;
+    const u8 *bmp_data;
+    size_t bmp_size;
+
+    TrMesh mesh;
+    Texture texture;
+    BmpInfo bmp;
+
+    JobCounter model_ready;
+    JobCounter done;
+};
+
+struct LevelBmpBand
+{
+    LevelLoad *level;
+    int row_begin;
+    int row_end;
+};
+
+// NOTE(annad): Parse and preprocess go through newlib malloc (new, vector,
+// std::cerr), which isn't assumed to be thread safe. They are the only
+// allocating jobs, chained through model_ready so never concurrent, and
+// the calling thread only touches arena until job_wait returns. BMP bands
+// write into preallocated pixels. Keep it that way when adding jobs.
+void level_parse_obj_job(void *data)
+{
+    LevelLoad *level = (LevelLoad*)data;
+    level->mesh.model = new Model(level->obj_data, level->obj_size);
+}
+
+void level_preprocess_job(void *data)
+{
+    LevelLoad *level = (LevelLoad*)data;
+    tr_mesh_build(&level->mesh, level->mesh.model);
+    if (level_pack_vertices)
+        tr_mesh_pack(&level->mesh);
+}
+
+void level_decode_bmp_job(void *data)
+{
+    LevelBmpBand *band = (LevelBmpBand*)data;
+    LevelLoad *level = band->level;
+    tr_bmp_decode_rows(&level->texture, &level->bmp, level->bmp_data, band->row_begin, band->row_end);
+}
+
+// NOTE(annad): Blocks until everything is decoded, the calling thread helps.
+// obj_data is parsed only when mesh.model is NULL.
+// Texture pixels and band descriptors are taken from arena.
+bool tr_level_load(LevelLoad *level, JobSystem *jobs, int thread, Arena *arena)
+{
+    PROFILE_ZONE("level_load");
+
+    level->model_ready.value = 0;
+    level->model_ready.continuations = NULL;
+    level->done.value = 0;
+    level->done.continuations = NULL;
+
+    // NOTE(annad): A model streamed while uploading (obj_stream) is already parsed.
+    if (level->mesh.model == NULL)
+        job_spawn(jobs, thread, level_parse_obj_job, level, &level->model_ready);
+
+    Job *preprocess = job_create(jobs, level_preprocess_job, level, &level->done);
+    if (preprocess != NULL)
+    {
+        job_run_after(jobs, thread, &level->model_ready, preprocess);
+    }
+    else
+    {
+        job_wait(jobs, thread, &level->model_ready);
+        level_preprocess_job(level);
+    }
+
+    bool result = tr_bmp_info(&level->bmp, level->bmp_data, level->bmp_size);
+    if (result)
+    {
+        level->texture.width = level->bmp.width;
+        level->texture.height = level->bmp.height;
+        level->texture.pixels = (u32*)arena_alloc(arena,
+            (size_t)level->bmp.width * level->bmp.height * sizeof(u32));
+
+        LevelBmpBand *bands = (LevelBmpBand*)arena_alloc(arena,
+            level_bmp_bands * sizeof(LevelBmpBand));
+        result = (level->texture.pixels != NULL && bands != NULL);
+
+        int rows = (level->bmp.height + level_bmp_bands - 1) / level_bmp_bands;
+        for (int i = 0; result && i < level_bmp_bands; i += 1)
+        {
+            bands[i].level = level;
+            bands[i].row_begin = std::min(i * rows, level->bmp.height);
+            bands[i].row_end = std::min((i + 1) * rows, level->bmp.height);
+            job_spawn(jobs, thread, level_decode_bmp_job, &bands[i], &level->done);
+        }
+    }
+
+    job_wait(jobs, thread, &level->done);
+    return result && level->mesh.model->nfaces() > 0;
+}
@@ -0,0 +1,321 @@
+/**
+ * File: tinyrend_meshlet.cpp
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 10:02:11
+ * Last Modified Date: 10/19/2026 08:11:39
+ */
+
+#include "tinyrend_meshlet.h"
+
+float tr_acmr(const int *indices, int index_count, int cache_size)
+{
+    if (index_count < 3)
+        return 0.0f;
+
+    std::vector<int> fifo(cache_size, -1);
+    int head = 0;
+    int misses = 0;
+    for (int i = 0; i < index_count; i += 1)
+    {
+        bool hit = false;
+        for (int j = 0; j < cache_size; j += 1)
+        {
+            if (fifo[j] == indices[i])
+            {
+                hit = true;
+                break;
+            }
+        }
+
+        if (!hit)
+        {
+            fifo[head] = indices[i];
+            head = (head + 1) % cache_size;
+            misses += 1;
+        }
+    }
+
+    return (float)misses / (float)(index_count / 3);
+}
+
+// NOTE(annad): Tom Forsyth, "Linear-Speed Vertex Cache Optimisation".
+const int forsyth_cache_size = 32;
+
+float forsyth_vertex_score(int cache_pos, int remaining)
+{
+    if (remaining == 0)
+        return -1.0f;
+
+    float score = 0.0f;
+    if (cache_pos >= 0)
+    {
+        if (cache_pos < 3)
+        {
+            score = 0.75f;
+        }
+        else
+        {
+            float scaler = 1.0f / (float)(forsyth_cache_size - 3);
+            score = 1.0f - (float)(cache_pos - 3) * scaler;
+            score = std::pow(score, 1.5f);
+        }
+    }
+
+    score += 2.0f / std::sqrt((float)remaining);
+    return score;
+}
+
+void tr_optimize_vertex_cache(int *dst, const int *indices, int index_count, int vertex_count)
+{
+    int tri_count = index_count / 3;
+
+    // NOTE(annad): Vertex -> triangles adjacency in one flat array.
+    std::vector<int> adj_offset(vertex_count + 1, 0);
+    std::vector<int> remaining(vertex_count, 0);
+    for (int i = 0; i < tri_count * 3; i += 1)
+        remaining[indices[i]] += 1;
+    for (int v = 0; v < vertex_count; v += 1)
+        adj_offset[v + 1] = adj_offset[v] + remaining[v];
+
+    std::vector<int> adj(adj_offset[vertex_count]);
+    std::vector<int> fill(adj_offset.begin(), adj_offset.end() - 1);
+    for (int t = 0; t < tri_count; t += 1)
+        for (int k = 0; k < 3; k += 1)
+            adj[fill[indices[t * 3 + k]]++] = t;
+
+    std::vector<int> cache_pos(vertex_count, -1);
+    std::vector<float> vscore(vertex_count);
+    for (int v = 0; v < vertex_count; v += 1)
+        vscore[v] = forsyth_vertex_score(-1, remaining[v]);
+
+    std::vector<float> tscore(tri_count);
+    std::vector<bool> emitted(tri_count, false);
+    for (int t = 0; t < tri_count; t += 1)
+    {
+        const int *tri = &indices[t * 3];
+        tscore[t] = vscore[tri[0]] + vscore[tri[1]] + vscore[tri[2]];
+    }
+
+    int cache[forsyth_cache_size + 3];
+    int cache_count = 0;
+    int scan_cursor = 0;
+
+    for (int out = 0; out < tri_count; out += 1)
+    {
+        // NOTE(annad): Best triangle among ones touched by the cache,
+        // fall back to linear scan when the cache gives nothing.
+        int best = -1;
+        float best_score = -1.0f;
+        for (int c = 0; c < cache_count; c += 1)
+        {
+            int v = cache[c];
+            for (int a = adj_offset[v]; a < adj_offset[v + 1]; a += 1)
+            {
+                int t = adj[a];
+                if (!emitted[t] && tscore[t] > best_score)
+                {
+                    best = t;
+                    best_score = tscore[t];
+                }
+            }
+        }
+
+        if (best < 0)
+        {
+            while (emitted[scan_cursor])
+                scan_cursor += 1;
+            best = scan_cursor;
+        }
+
+        const int *tri = &indices[best * 3];
+        dst[out * 3 + 0] = tri[0];
+        dst[out * 3 + 1] = tri[1];
+        dst[out * 3 + 2] = tri[2];
+        emitted[best] = true;
+
+        for (int k = 0; k < 3; k += 1)
+            remaining[tri[k]] -= 1;
+
+        // NOTE(annad): Move emitted vertices to the front of LRU cache.
+        int next[forsyth_cache_size + 3];
+        int next_count = 0;
+        for (int k = 0; k < 3; k += 1)
+            next[next_count++] = tri[k];
+        for (int c = 0; c < cache_count; c += 1)
+        {
+            int v = cache[c];
+            if (v != tri[0] && v != tri[1] && v != tri[2])
+                next[next_count++] = v;
+        }
+
+        for (int c = 0; c < next_count; c += 1)
+        {
+            int v = next[c];
+            cache_pos[v] = (c < forsyth_cache_size) ? c : -1;
+            vscore[v] = forsyth_vertex_score(cache_pos[v], remaining[v]);
+        }
+
+        cache_count = std::min(next_count, forsyth_cache_size);
+        for (int c = 0; c < cache_count; c += 1)
+            cache[c] = next[c];
+
+        // NOTE(annad): Refresh scores of triangles whose vertices moved.
+        for (int c = 0; c < next_count; c += 1)
+        {
+            int v = next[c];
+            for (int a = adj_offset[v]; a < adj_offset[v + 1]; a += 1)
+            {
+                int t = adj[a];
+                if (emitted[t])
+                    continue;
+                const int *ttri = &indices[t * 3];
+                tscore[t] = vscore[ttri[0]] + vscore[ttri[1]] + vscore[ttri[2]];
+            }
+        }
+    }
+}
+
+void tr_model_optimize(Model *model)
+{
+    std::vector<int> indices = model->indices();
+    if (indices.empty())
+        return;
+
+    std::vector<int> optimized(indices.size());
+    float acmr_before = tr_acmr(&indices[0], (int)indices.size(), vcache_fifo_size);
+    tr_optimize_vertex_cache(&optimized[0], &indices[0], (int)indices.size(), model->nverts());
+    float acmr_after = tr_acmr(&optimized[0], (int)optimized.size(), vcache_fifo_size);
+    model->set_indices(optimized);
+
+    std::cerr << "# acmr " << acmr_before << " -> " << acmr_after << std::endl;
+}
+
+void meshlet_compute_bounds(MeshletMesh *mesh, Meshlet *meshlet, Model *model)
+{
+    const int *vertices = &mesh->vertices[meshlet->vertex_offset];
+    const unsigned char *triangles = &mesh->triangles[meshlet->triangle_offset * 3];
+
+    Vec3f bmin = model->vert(vertices[0]);
+    Vec3f bmax = bmin;
+    for (int i = 1; i < meshlet->vertex_count; i += 1)
+    {
+        Vec3f v = model->vert(vertices[i]);
+        for (int j = 0; j < 3; j += 1)
+        {
+            bmin[j] = std::min(bmin[j], v[j]);
+            bmax[j] = std::max(bmax[j], v[j]);
+        }
+    }
+
+    meshlet->center = (bmin + bmax) * 0.5f;
+    meshlet->radius = 0.0f;
+    for (int i = 0; i < meshlet->vertex_count; i += 1)
+    {
+        Vec3f d = model->vert(vertices[i]) - meshlet->center;
+        meshlet->radius = std::max(meshlet->radius, d.norm());
+    }
+
+    // NOTE(annad): Same winding as tr_draw_instances, n * view_dir > 0 is front.
+    Vec3f normals[meshlet_max_triangles];
+    Vec3f axis(0, 0, 0);
+    int normal_count = 0;
+    for (int i = 0; i < meshlet->triangle_count; i += 1)
+    {
+        Vec3f a = model->vert(vertices[triangles[i * 3 + 0]]);
+        Vec3f b = model->vert(vertices[triangles[i * 3 + 1]]);
+        Vec3f c = model->vert(vertices[triangles[i * 3 + 2]]);
+        Vec3f n = cross(c - a, b - a);
+        if (n.norm() < 1e-12f)
+            continue;
+        n.normalize();
+        normals[normal_count++] = n;
+        axis = axis + n;
+    }
+
+    meshlet->cone_axis = Vec3f(0, 0, 0);
+    meshlet->cone_cutoff = 2.0f;
+    if (normal_count == 0 || axis.norm() < 1e-6f)
+        return;
+
+    axis.normalize();
+    float mindp = 1.0f;
+    for (int i = 0; i < normal_count; i += 1)
+        mindp = std::min(mindp, normals[i] * axis);
+
+    meshlet->cone_axis = axis;
+    if (mindp > 0.0f)
+        meshlet->cone_cutoff = std::sqrt(1.0f - mindp * mindp);
+}
+
+void tr_build_meshlets(MeshletMesh *mesh, Model *model)
+{
+    mesh->meshlets.clear();
+    mesh->vertices.clear();
+    mesh->triangles.clear();
+
+    std::vector<int> indices = model->indices();
+    std::vector<int> local(model->nverts(), -1);
+
+    Meshlet current = {};
+    for (size_t t = 0; t + 2 < indices.size(); t += 3)
+    {
+        int extra = 0;
+        for (int k = 0; k < 3; k += 1)
+            extra += (local[indices[t + k]] < 0);
+
+        if (current.vertex_count + extra > meshlet_max_vertices
+            || current.triangle_count + 1 > meshlet_max_triangles)
+        {
+            for (int i = 0; i < current.vertex_count; i += 1)
+                local[mesh->vertices[current.vertex_offset + i]] = -1;
+            meshlet_compute_bounds(mesh, &current, model);
+            mesh->meshlets.push_back(current);
+
+            current = Meshlet();
+            current.vertex_offset = (int)mesh->vertices.size();
+            current.triangle_offset = (int)(mesh->triangles.size() / 3);
+        }
+
+        for (int k = 0; k < 3; k += 1)
+        {
+            int v = indices[t + k];
+            if (local[v] < 0)
+            {
+                local[v] = current.vertex_count++;
+                mesh->vertices.push_back(v);
+            }
+            mesh->triangles.push_back((unsigned char)local[v]);
+        }
+
+        current.triangle_count += 1;
+    }
+
+    if (current.triangle_count > 0)
+    {
+        meshlet_compute_bounds(mesh, &current, model);
+        mesh->meshlets.push_back(current);
+    }
+
+    std::cerr << "# meshlets " << mesh->meshlets.size() << std::endl;
+}
+
+// NOTE(annad): view_dir is the camera direction, not the light. A single
+// direction for the whole meshlet is only right for the orthographic view,
+// a perspective one needs the direction from the eye to the cone apex.
+bool tr_meshlet_backfacing(const Meshlet *meshlet, Vec3f view_dir)
+{
+    return (meshlet->cone_axis * view_dir) <= -meshlet->cone_cutoff;
+}
+
+bool tr_meshlet_outside(const Meshlet *meshlet)
+{
+    // NOTE(annad): Orthographic view, visible volume is [-1, 1] on x and y.
+    for (int j = 0; j < 2; j += 1)
+    {
+        if (meshlet->center[j] + meshlet->radius < -1.0f
+            || meshlet->center[j] - meshlet->radius > 1.0f)
+            return true;
+    }
+
+    return false;
+}
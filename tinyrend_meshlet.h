@@ -0,0 +1,50 @@
+/**
+ * File: tinyrend_meshlet.h
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 10:02:11
+ * Last Modified Date: 10/19/2026 10:02:11
+ */
+
+#pragma once
+
+#include <vector>
+#include "tinyrend_geometry.h"
+#include "tinyrend_model.h"
+
+const int meshlet_max_vertices = 64;
+const int meshlet_max_triangles = 124;
+
+// NOTE(annad): Size of the simulated FIFO post-transform cache for ACMR.
+const int vcache_fifo_size = 16;
+
+struct Meshlet
+{
+    int vertex_offset;
+    int vertex_count;
+    int triangle_offset;
+    int triangle_count;
+
+    // NOTE(annad): Bounding sphere in model space.
+    Vec3f center;
+    float radius;
+
+    // NOTE(annad): Normal cone, cone_cutoff = sin(half angle of the cone),
+    // 2.0f if normals spread over more than a hemisphere (never culled).
+    Vec3f cone_axis;
+    float cone_cutoff;
+};
+
+struct MeshletMesh
+{
+    std::vector<Meshlet> meshlets;
+    std::vector<int> vertices; // NOTE(annad): Indices into Model verts.
+    std::vector<unsigned char> triangles; // NOTE(annad): Local, 3 per triangle.
+};
+
+float tr_acmr(const int *indices, int index_count, int cache_size);
+void tr_optimize_vertex_cache(int *dst, const int *indices, int index_count, int vertex_count);
+void tr_model_optimize(Model *model);
+
+void tr_build_meshlets(MeshletMesh *mesh, Model *model);
+bool tr_meshlet_backfacing(const Meshlet *meshlet, Vec3f view_dir);
+bool tr_meshlet_outside(const Meshlet *meshlet);
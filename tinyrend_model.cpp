@@ -4,32 +4,33 @@
 #include <sstream>
 #include <vector>
 #include "tinyrend_model.h"
+#include "tinyrend_obj.h"
 
-Model::Model(const char *filename) : verts_(), faces_() {
+Model::Model(const char *filename) : verts_(), uvs_(), norms_(), faces_() {
     std::ifstream in;
-    in.open (filename, std::ifstream::in);
+    in.open (filename, std::ifstream::in | std::ifstream::binary);
     if (in.fail()) return;
-    std::string line;
-    while (!in.eof()) {
-        std::getline(in, line);
-        std::istringstream iss(line.c_str());
-        char trash;
-        if (!line.compare(0, 2, "v ")) {
-            iss >> trash;
-            Vec3f v;
-            for (int i=0;i<3;i++) iss >> v[i];
-            verts_.push_back(v);
-        } else if (!line.compare(0, 2, "f ")) {
-            std::vector<int> f;
-            int itrash, idx;
-            iss >> trash;
-            while (iss >> idx >> trash >> itrash >> trash >> itrash) {
-                idx--; // in wavefront obj all indices start at 1, not zero
-                f.push_back(idx);
-            }
-            faces_.push_back(f);
-        }
-    }
+    load(in);
+}
+
+Model::Model() : verts_(), uvs_(), norms_(), faces_() {
+}
+
+Model::Model(const char *data, size_t size) : verts_(), uvs_(), norms_(), faces_() {
+    ObjParser parser;
+    obj_parser_init(&parser, this);
+    obj_parser_feed(&parser, data, size);
+    obj_parser_finish(&parser);
+    std::cerr << "# v# " << verts_.size() << " f# "  << faces_.size() << std::endl;
+}
+
+void Model::load(std::istream &in) {
+    ObjParser parser;
+    obj_parser_init(&parser, this);
+    char buffer[4096];
+    while (in.read(buffer, sizeof(buffer)) || in.gcount() > 0)
+        obj_parser_feed(&parser, buffer, (size_t)in.gcount());
+    obj_parser_finish(&parser);
     std::cerr << "# v# " << verts_.size() << " f# "  << faces_.size() << std::endl;
 }
 
@@ -51,3 +52,50 @@ std::vector<int> Model::face(int idx) {
 Vec3f Model::vert(int i) {
     return verts_[i];
 }
+
+Vec2f Model::uv(int i) {
+    return uvs_[i];
+}
+
+Vec3f Model::normal(int i) {
+    return norms_[i];
+}
+
+std::vector<int> Model::indices() {
+    std::vector<int> ret;
+    for (size_t i=0; i<faces_.size(); i++) {
+        const std::vector<int> &f = faces_[i];
+        for (size_t j=2; j<f.size(); j++) { // NOTE(annad): fan for n-gons
+            ret.push_back(f[0]);
+            ret.push_back(f[j-1]);
+            ret.push_back(f[j]);
+        }
+    }
+    return ret;
+}
+
+void Model::set_indices(const std::vector<int> &indices) {
+    faces_.clear();
+    for (size_t i=0; i+2<indices.size(); i+=3) {
+        std::vector<int> f(indices.begin()+i, indices.begin()+i+3);
+        faces_.push_back(f);
+    }
+}
+
+void Model::add_vert(const Vec3f &v, const Vec2f &uv, const Vec3f &n) {
+    verts_.push_back(v);
+    uvs_.push_back(uv);
+    norms_.push_back(n);
+}
+
+// NOTE(annad): Frees the float attributes once a packed copy exists,
+// faces stay.
+void Model::clear_verts() {
+    std::vector<Vec3f>().swap(verts_);
+    std::vector<Vec2f>().swap(uvs_);
+    std::vector<Vec3f>().swap(norms_);
+}
+
+void Model::add_face(const std::vector<int> &f) {
+    faces_.push_back(f);
+}
@@ -7,14 +7,26 @@
 class Model {
 private:
 	std::vector<Vec3f> verts_;
+	std::vector<Vec2f> uvs_;
+	std::vector<Vec3f> norms_;
 	std::vector<std::vector<int> > faces_;
+	void load(std::istream &in);
 public:
+	Model();
 	Model(const char *filename);
+	Model(const char *data, size_t size);
 	~Model();
 	int nverts();
 	int nfaces();
 	Vec3f vert(int i);
+	Vec2f uv(int i);
+	Vec3f normal(int i);
 	std::vector<int> face(int idx);
+	std::vector<int> indices();
+	void set_indices(const std::vector<int> &indices);
+	void add_vert(const Vec3f &v, const Vec2f &uv, const Vec3f &n);
+	void clear_verts();
+	void add_face(const std::vector<int> &f);
 };
 
 #endif //__MODEL_H__
@@ -0,0 +1,152 @@
+/**
+ * File: tinyrend_obj.cpp
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 21:26:50
+ * Last Modified Date: 10/19/2026 08:25:27
+ */
+
+#include <stdlib.h>
+#include "tinyrend_obj.h"
+
+void obj_parser_init(ObjParser *parser, Model *model)
+{
+    parser->model = model;
+    parser->length = 0;
+    parser->overflow = false;
+    parser->positions.clear();
+    parser->uvs.clear();
+    parser->normals.clear();
+    parser->vertices.clear();
+}
+
+// NOTE(annad): In wavefront obj indices start at 1, negative ones are
+// relative, 0 means absent. Returns -1 for absent or out of range.
+int obj_index(long idx, size_t count)
+{
+    long result = (idx < 0) ? (long)count + idx : idx - 1;
+    return (idx != 0 && result >= 0 && result < (long)count) ? (int)result : -1;
+}
+
+int obj_vertex(ObjParser *parser, int v, int vt, int vn)
+{
+    u64 key = (u64)v | (u64)(vt + 1) << 21 | (u64)(vn + 1) << 42;
+    std::unordered_map<u64, int>::iterator it = parser->vertices.find(key);
+    if (it != parser->vertices.end())
+        return it->second;
+
+    int index = parser->model->nverts();
+    parser->model->add_vert(parser->positions[v], 
+        (vt >= 0) ? parser->uvs[vt] : Vec2f(0, 0),
+        (vn >= 0) ? parser->normals[vn] : Vec3f(0, 0, 0));
+    parser->vertices[key] = index;
+    return index;
+}
+
+void obj_parse_line(ObjParser *parser, char *line)
+{
+    if (line[0] == 'v' && line[1] == ' ')
+    {
+        char *cursor = line + 2;
+        Vec3f v;
+        for (int i = 0; i < 3; i += 1)
+            v[i] = strtof(cursor, &cursor);
+        if (parser->positions.size() < obj_max_pool)
+            parser->positions.push_back(v);
+    }
+    else if (line[0] == 'v' && line[1] == 't' && line[2] == ' ')
+    {
+        char *cursor = line + 3;
+        Vec2f uv;
+        for (int i = 0; i < 2; i += 1)
+            uv[i] = strtof(cursor, &cursor);
+        if (parser->uvs.size() < obj_max_pool)
+            parser->uvs.push_back(uv);
+    }
+    else if (line[0] == 'v' && line[1] == 'n' && line[2] == ' ')
+    {
+        char *cursor = line + 3;
+        Vec3f n;
+        for (int i = 0; i < 3; i += 1)
+            n[i] = strtof(cursor, &cursor);
+        if (parser->normals.size() < obj_max_pool)
+            parser->normals.push_back(n);
+    }
+    else if (line[0] == 'f' && line[1] == ' ')
+    {
+        // NOTE(annad): v, v/vt, v//vn, v/vt/vn.
+        std::vector<int> f;
+        char *cursor = line + 2;
+        for (;;)
+        {
+            char *end = cursor;
+            long idx[3] = {0, 0, 0};
+            idx[0] = strtol(cursor, &end, 10);
+            if (end == cursor)
+                break;
+
+            cursor = end;
+            for (int k = 1; k < 3 && *cursor == '/'; k += 1)
+            {
+                idx[k] = strtol(cursor + 1, &end, 10);
+                cursor = end;
+            }
+
+            while (*cursor != '\0' && *cursor != ' ' && *cursor != '\t')
+                cursor++;
+
+            int v = obj_index(idx[0], parser->positions.size());
+            if (v < 0)
+                return; // NOTE(annad): Broken face, dropped.
+
+            f.push_back(obj_vertex(parser, v, 
+                obj_index(idx[1], parser->uvs.size()), 
+                obj_index(idx[2], parser->normals.size())));
+        }
+        parser->model->add_face(f);
+    }
+}
+
+void obj_parser_feed(ObjParser *parser, const char *data, size_t size)
+{
+    for (size_t i = 0; i < size; i += 1)
+    {
+        char c = data[i];
+        if (c == '\n' || c == '\r')
+        {
+            if (!parser->overflow && parser->length > 0)
+            {
+                parser->line[parser->length] = '\0';
+                obj_parse_line(parser, parser->line);
+            }
+            parser->length = 0;
+            parser->overflow = false;
+        }
+        else if (parser->length < obj_max_line - 1)
+        {
+            parser->line[parser->length++] = c;
+        }
+        else
+        {
+            parser->overflow = true;
+        }
+    }
+}
+
+// NOTE(annad): Flushes the last line when the file doesn't end with newline.
+// NOTE(annad): The pools are only needed while faces come in, their
+// memory goes back here, clear() would keep the capacity.
+void obj_parser_finish(ObjParser *parser)
+{
+    const char newline = '\n';
+    obj_parser_feed(parser, &newline, 1);
+
+    std::vector<Vec3f>().swap(parser->positions);
+    std::vector<Vec2f>().swap(parser->uvs);
+    std::vector<Vec3f>().swap(parser->normals);
+    std::unordered_map<u64, int>().swap(parser->vertices);
+}
+
+void obj_stream(void *user, const char *data, size_t size)
+{
+    obj_parser_feed((ObjParser*)user, data, size);
+}
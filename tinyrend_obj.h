@@ -0,0 +1,40 @@
+/**
+ * File: tinyrend_obj.h
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 21:26:50
+ * Last Modified Date: 10/19/2026 08:25:27
+ */
+
+#pragma once
+
+#include <unordered_map>
+#include "tinyrend_model.h"
+
+const int obj_max_line = 256;
+
+// NOTE(annad): obj_vertex packs v, vt + 1 and vn + 1 into 21 bit fields of
+// one key, so the pools are capped below that. Lines past the cap are
+// dropped, references to them are out of range.
+const size_t obj_max_pool = (1 << 21) - 1;
+
+// NOTE(annad): Resumable OBJ parser, data may be cut anywhere, the tail
+// of an unfinished line is carried over to the next feed.
+struct ObjParser
+{
+    Model *model;
+    char line[obj_max_line];
+    int length;
+    bool overflow; // NOTE(annad): Line longer than obj_max_line, skipped.
+
+    // NOTE(annad): v, vt and vn pools, model vertices are unique v/vt/vn
+    // triples referenced by faces.
+    std::vector<Vec3f> positions;
+    std::vector<Vec2f> uvs;
+    std::vector<Vec3f> normals;
+    std::unordered_map<u64, int> vertices;
+};
+
+void obj_parser_init(ObjParser *parser, Model *model);
+void obj_parser_feed(ObjParser *parser, const char *data, size_t size);
+void obj_parser_finish(ObjParser *parser);
+void obj_stream(void *user, const char *data, size_t size);
@@ -0,0 +1,237 @@
+/**
+ * File: tinyrend_tile.cpp
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 22:05:12
+ * Last Modified Date: 10/19/2026 08:00:07
+ */
+
+#include <float.h>
+#include <string.h>
+#include "tinyrend_tile.h"
+
+// NOTE(annad): Triangles are collected first, tr_tile_end bins them and
+// renders tile by tile. Everything is taken from arena, which is expected
+// to be reset by the caller (frame arena).
+bool tr_tile_begin(TileRenderer *tr, Screen *screen, Arena *arena, int max_triangles)
+{
+    tr->screen = screen;
+    tr->arena = arena;
+    tr->tiles_x = (screen->width + tile_width - 1) / tile_width;
+    tr->tiles_y = (screen->height + tile_height - 1) / tile_height;
+    tr->clear_color = 0x0;
+    tr->triangle_count = 0;
+    tr->triangle_max = max_triangles;
+    tr->sort = true;
+    tr->nearest_min = FLT_MAX;
+    tr->nearest_max = -FLT_MAX;
+    tr->pixels_shaded = 0;
+    tr->pixels_visible = 0;
+    tr->tile = (Tile*)arena_alloc(arena, sizeof(Tile));
+    tr->triangles = (TileTriangle*)arena_alloc(arena, max_triangles * sizeof(TileTriangle));
+    return tr->tile != NULL && tr->triangles != NULL;
+}
+
+bool tr_tile_triangle(TileRenderer *tr, const Vec3f *pts, u32 color)
+{
+    if (tr->triangle_count == tr->triangle_max)
+        return false;
+
+    float area = (pts[1].x - pts[0].x) * (pts[2].y - pts[0].y) 
+        - (pts[1].y - pts[0].y) * (pts[2].x - pts[0].x);
+    if (std::abs(area) < 1e-2f)
+        return true; // NOTE(annad): Degenerate, same as tr_barycentric.
+
+    TileTriangle *t = &tr->triangles[tr->triangle_count];
+    t->xmin = std::max(0, (int)std::floor(std::min(pts[0].x, std::min(pts[1].x, pts[2].x))));
+    t->ymin = std::max(0, (int)std::floor(std::min(pts[0].y, std::min(pts[1].y, pts[2].y))));
+    t->xmax = std::min(tr->screen->width - 1, (int)std::ceil(std::max(pts[0].x, std::max(pts[1].x, pts[2].x))));
+    t->ymax = std::min(tr->screen->height - 1, (int)std::ceil(std::max(pts[0].y, std::max(pts[1].y, pts[2].y))));
+    if (t->xmin > t->xmax || t->ymin > t->ymax)
+        return true;
+
+    float inv_area = 1.0f / area;
+    for (int i = 0; i < 3; i += 1)
+    {
+        // NOTE(annad): Weight of vertex i is the edge opposite to it.
+        const Vec3f &v0 = pts[(i + 1) % 3];
+        const Vec3f &v1 = pts[(i + 2) % 3];
+        t->edge[i][0] = -(v1.y - v0.y) * inv_area;
+        t->edge[i][1] =  (v1.x - v0.x) * inv_area;
+        t->edge[i][2] =  ((v1.y - v0.y) * v0.x - (v1.x - v0.x) * v0.y) * inv_area;
+    }
+
+    for (int j = 0; j < 3; j += 1)
+        t->depth[j] = t->edge[0][j] * pts[0].z + t->edge[1][j] * pts[1].z + t->edge[2][j] * pts[2].z;
+
+    t->nearest = std::max(pts[0].z, std::max(pts[1].z, pts[2].z));
+    tr->nearest_min = std::min(tr->nearest_min, t->nearest);
+    tr->nearest_max = std::max(tr->nearest_max, t->nearest);
+    t->color = color;
+    tr->triangle_count += 1;
+    return true;
+}
+
+// NOTE(annad): Returns the number of pixels shaded.
+int tr_tile_raster(Tile *tile, int tile_x, int tile_y, const TileTriangle *t)
+{
+    int shaded = 0;
+    int x0 = std::max(t->xmin, tile_x);
+    int x1 = std::min(t->xmax, tile_x + tile_width - 1);
+    int y0 = std::max(t->ymin, tile_y);
+    int y1 = std::min(t->ymax, tile_y + tile_height - 1);
+
+    for (int y = y0; y <= y1; y += 1)
+    {
+        float w0 = t->edge[0][0] * x0 + t->edge[0][1] * y + t->edge[0][2];
+        float w1 = t->edge[1][0] * x0 + t->edge[1][1] * y + t->edge[1][2];
+        float w2 = t->edge[2][0] * x0 + t->edge[2][1] * y + t->edge[2][2];
+        float z  = t->depth[0] * x0 + t->depth[1] * y + t->depth[2];
+
+        u32 *color = &tile->color[(y - tile_y) * tile_width];
+        float *depth = &tile->depth[(y - tile_y) * tile_width];
+        for (int x = x0 - tile_x; x <= x1 - tile_x; x += 1)
+        {
+            if (w0 >= 0 && w1 >= 0 && w2 >= 0 && depth[x] < z)
+            {
+                depth[x] = z;
+                color[x] = t->color;
+                shaded += 1;
+            }
+
+            w0 += t->edge[0][0];
+            w1 += t->edge[1][0];
+            w2 += t->edge[2][0];
+            z  += t->depth[0];
+        }
+    }
+
+    return shaded;
+}
+
+// NOTE(annad): LSD radix sort of the triangles on 16 bit quantized nearest
+// depth, two 8 bit passes. Larger z is closer, it goes first.
+int *tr_tile_sort(TileRenderer *tr)
+{
+    PROFILE_ZONE("tile_sort");
+    int count = tr->triangle_count;
+    u16 *keys = (u16*)arena_alloc(tr->arena, 2 * count * sizeof(u16));
+    int *order = (int*)arena_alloc(tr->arena, 2 * count * sizeof(int));
+    if (keys == NULL || order == NULL)
+        return NULL;
+
+    u16 *keys_tmp = keys + count;
+    int *order_tmp = order + count;
+    float range = tr->nearest_max - tr->nearest_min;
+    float scale = (range > 0.0f) ? 65535.0f / range : 0.0f;
+    for (int i = 0; i < count; i += 1)
+    {
+        keys[i] = (u16)((tr->nearest_max - tr->triangles[i].nearest) * scale);
+        order[i] = i;
+    }
+
+    for (int shift = 0; shift < 16; shift += 8)
+    {
+        int offsets[257] = {};
+        for (int i = 0; i < count; i += 1)
+            offsets[((keys[i] >> shift) & 0xff) + 1] += 1;
+        for (int i = 0; i < 256; i += 1)
+            offsets[i + 1] += offsets[i];
+
+        for (int i = 0; i < count; i += 1)
+        {
+            int dst = offsets[(keys[i] >> shift) & 0xff]++;
+            keys_tmp[dst] = keys[i];
+            order_tmp[dst] = order[i];
+        }
+
+        std::swap(keys, keys_tmp);
+        std::swap(order, order_tmp);
+    }
+
+    return order;
+}
+
+// NOTE(annad): One copy per tile row, the rows are contiguous in both.
+void tr_tile_flush(Screen *screen, const Tile *tile, int tile_x, int tile_y)
+{
+    int rows = std::min(tile_height, screen->height - tile_y);
+    int cols = std::min(tile_width, screen->width - tile_x);
+    for (int r = 0; r < rows; r += 1)
+        memcpy(screen_row(screen, tile_y + r) + tile_x, &tile->color[r * tile_width], cols * sizeof(u32));
+}
+
+// NOTE(annad): Every tile is flushed, so the screen doesn't need clearing.
+bool tr_tile_end(TileRenderer *tr)
+{
+    int tile_count = tr->tiles_x * tr->tiles_y;
+    int *offsets = (int*)arena_alloc(tr->arena, (tile_count + 1) * sizeof(int));
+    int *cursors = (int*)arena_alloc(tr->arena, tile_count * sizeof(int));
+    if (offsets == NULL || cursors == NULL)
+        return false;
+
+    int *order = NULL;
+    if (tr->sort && tr->triangle_count > 1)
+    {
+        order = tr_tile_sort(tr);
+        if (order == NULL)
+            return false;
+    }
+
+    for (int i = 0; i <= tile_count; i += 1)
+        offsets[i] = 0;
+
+    for (int i = 0; i < tr->triangle_count; i += 1)
+    {
+        const TileTriangle *t = &tr->triangles[i];
+        for (int ty = t->ymin / tile_height; ty <= t->ymax / tile_height; ty += 1)
+            for (int tx = t->xmin / tile_width; tx <= t->xmax / tile_width; tx += 1)
+                offsets[ty * tr->tiles_x + tx + 1] += 1;
+    }
+
+    for (int i = 0; i < tile_count; i += 1)
+    {
+        offsets[i + 1] += offsets[i];
+        cursors[i] = offsets[i];
+    }
+
+    // NOTE(annad): Sorted (or submission) order is kept inside every bin.
+    int *bins = (int*)arena_alloc(tr->arena, std::max(offsets[tile_count], 1) * sizeof(int));
+    if (bins == NULL)
+        return false;
+
+    for (int i = 0; i < tr->triangle_count; i += 1)
+    {
+        int index = (order != NULL) ? order[i] : i;
+        const TileTriangle *t = &tr->triangles[index];
+        for (int ty = t->ymin / tile_height; ty <= t->ymax / tile_height; ty += 1)
+            for (int tx = t->xmin / tile_width; tx <= t->xmax / tile_width; tx += 1)
+                bins[cursors[ty * tr->tiles_x + tx]++] = index;
+    }
+
+    Tile *tile = tr->tile;
+    for (int ty = 0; ty < tr->tiles_y; ty += 1)
+    {
+        for (int tx = 0; tx < tr->tiles_x; tx += 1)
+        {
+            for (int i = 0; i < tile_height * tile_width; i += 1)
+            {
+                tile->color[i] = tr->clear_color;
+                tile->depth[i] = -FLT_MAX;
+            }
+
+            int bin = ty * tr->tiles_x + tx;
+            for (int i = offsets[bin]; i < offsets[bin + 1]; i += 1)
+                tr->pixels_shaded += tr_tile_raster(tile, tx * tile_width, ty * tile_height, &tr->triangles[bins[i]]);
+
+            if (offsets[bin] != offsets[bin + 1])
+            {
+                for (int i = 0; i < tile_height * tile_width; i += 1)
+                    tr->pixels_visible += (tile->depth[i] != -FLT_MAX);
+            }
+
+            tr_tile_flush(tr->screen, tile, tx * tile_width, ty * tile_height);
+        }
+    }
+
+    return true;
+}
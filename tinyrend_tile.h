@@ -0,0 +1,58 @@
+/**
+ * File: tinyrend_tile.h
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 22:05:12
+ * Last Modified Date: 10/19/2026 08:00:07
+ */
+
+#pragma once
+
+const int tile_width = 64;
+const int tile_height = 16;
+
+// NOTE(annad): 8KB, color and depth of a tile fit the 16KB data cache
+// together. The framebuffer is written only when a tile is done.
+struct Tile
+{
+    u32 color[tile_height * tile_width];
+    float depth[tile_height * tile_width];
+};
+
+// NOTE(annad): Barycentric weights and depth as planes over the screen,
+// w[i] = edge[i][0] * x + edge[i][1] * y + edge[i][2].
+struct TileTriangle
+{
+    float edge[3][3];
+    float depth[3];
+    float nearest; // NOTE(annad): Max z of the vertices, the sort key.
+    u32 color;
+    int xmin, ymin, xmax, ymax; // NOTE(annad): Inclusive, inside the screen.
+};
+
+struct TileRenderer
+{
+    Screen *screen;
+    Arena *arena;
+    Tile *tile;
+    int tiles_x;
+    int tiles_y;
+    u32 clear_color;
+
+    TileTriangle *triangles;
+    int triangle_count;
+    int triangle_max;
+
+    // NOTE(annad): Front to back, so hidden pixels fail the depth test
+    // instead of being shaded and overwritten.
+    bool sort;
+    float nearest_min;
+    float nearest_max;
+
+    // NOTE(annad): Overdraw is pixels_shaded / pixels_visible.
+    u32 pixels_shaded;
+    u32 pixels_visible;
+};
+
+bool tr_tile_begin(TileRenderer *tr, Screen *screen, Arena *arena, int max_triangles);
+bool tr_tile_triangle(TileRenderer *tr, const Vec3f *pts, u32 color);
+bool tr_tile_end(TileRenderer *tr);
@@ -0,0 +1,134 @@
+/**
+ * File: tinyrend_vertex.cpp
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 23:31:08
+ * Last Modified Date: 10/19/2026 08:16:42
+ */
+
+#include "tinyrend_vertex.h"
+
+float oct_sign(float v)
+{
+    return (v < 0.0f) ? -1.0f : 1.0f;
+}
+
+u16 quantize_unorm16(float v)
+{
+    v = std::min(std::max(v, 0.0f), 1.0f);
+    return (u16)(v * 65535.0f + 0.5f);
+}
+
+// NOTE(annad): Projects onto the octahedron |x| + |y| + |z| = 1 and folds
+// the lower half over the diagonals, then two snorm8 in unorm form.
+void tr_oct_encode(Vec3f n, u8 *out)
+{
+    float l1 = std::abs(n.x) + std::abs(n.y) + std::abs(n.z);
+    float x = (l1 > 0.0f) ? n.x / l1 : 0.0f;
+    float y = (l1 > 0.0f) ? n.y / l1 : 0.0f;
+    if (n.z < 0.0f)
+    {
+        float fx = (1.0f - std::abs(y)) * oct_sign(x);
+        float fy = (1.0f - std::abs(x)) * oct_sign(y);
+        x = fx;
+        y = fy;
+    }
+
+    out[0] = (u8)((x * 0.5f + 0.5f) * 255.0f + 0.5f);
+    out[1] = (u8)((y * 0.5f + 0.5f) * 255.0f + 0.5f);
+}
+
+Vec3f tr_oct_decode(const u8 *in)
+{
+    float x = in[0] * (2.0f / 255.0f) - 1.0f;
+    float y = in[1] * (2.0f / 255.0f) - 1.0f;
+    float z = 1.0f - std::abs(x) - std::abs(y);
+    if (z < 0.0f)
+    {
+        float fx = (1.0f - std::abs(y)) * oct_sign(x);
+        float fy = (1.0f - std::abs(x)) * oct_sign(y);
+        x = fx;
+        y = fy;
+    }
+
+    Vec3f n(x, y, z);
+    return n.normalize();
+}
+
+void tr_pack_vertices(PackedVertices *packed, Model *model)
+{
+    int count = model->nverts();
+    packed->vertices.resize(count);
+    if (count == 0)
+        return;
+
+    Vec3f bmin = model->vert(0);
+    Vec3f bmax = bmin;
+    Vec2f uv_min = model->uv(0);
+    Vec2f uv_max = uv_min;
+    for (int i = 1; i < count; i += 1)
+    {
+        Vec3f v = model->vert(i);
+        for (int j = 0; j < 3; j += 1)
+        {
+            bmin[j] = std::min(bmin[j], v[j]);
+            bmax[j] = std::max(bmax[j], v[j]);
+        }
+
+        Vec2f uv = model->uv(i);
+        for (int j = 0; j < 2; j += 1)
+        {
+            uv_min[j] = std::min(uv_min[j], uv[j]);
+            uv_max[j] = std::max(uv_max[j], uv[j]);
+        }
+    }
+
+    Vec3f inv_scale;
+    for (int j = 0; j < 3; j += 1)
+    {
+        float extent = bmax[j] - bmin[j];
+        packed->scale[j] = (extent > 0.0f) ? extent / 65535.0f : 0.0f;
+        inv_scale[j] = (extent > 0.0f) ? 1.0f / extent : 0.0f;
+    }
+    packed->offset = bmin;
+
+    Vec2f uv_inv_scale;
+    for (int j = 0; j < 2; j += 1)
+    {
+        float extent = uv_max[j] - uv_min[j];
+        packed->uv_scale[j] = (extent > 0.0f) ? extent / 65535.0f : 0.0f;
+        uv_inv_scale[j] = (extent > 0.0f) ? 1.0f / extent : 0.0f;
+    }
+    packed->uv_offset = uv_min;
+
+    for (int i = 0; i < count; i += 1)
+    {
+        PackedVertex *p = &packed->vertices[i];
+        Vec3f v = model->vert(i);
+        Vec2f uv = model->uv(i);
+        for (int j = 0; j < 3; j += 1)
+            p->position[j] = quantize_unorm16((v[j] - bmin[j]) * inv_scale[j]);
+        for (int j = 0; j < 2; j += 1)
+            p->uv[j] = quantize_unorm16((uv[j] - uv_min[j]) * uv_inv_scale[j]);
+        tr_oct_encode(model->normal(i), p->normal);
+    }
+}
+
+Vec3f tr_unpack_position(const PackedVertices *packed, const PackedVertex *v)
+{
+    return Vec3f(
+        packed->offset.x + v->position[0] * packed->scale.x,
+        packed->offset.y + v->position[1] * packed->scale.y,
+        packed->offset.z + v->position[2] * packed->scale.z);
+}
+
+Vec2f tr_unpack_uv(const PackedVertices *packed, const PackedVertex *v)
+{
+    return Vec2f(
+        packed->uv_offset.x + v->uv[0] * packed->uv_scale.x,
+        packed->uv_offset.y + v->uv[1] * packed->uv_scale.y);
+}
+
+Vec3f tr_unpack_normal(const PackedVertex *v)
+{
+    return tr_oct_decode(v->normal);
+}
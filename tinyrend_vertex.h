@@ -0,0 +1,34 @@
+/**
+ * File: tinyrend_vertex.h
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 23:31:08
+ * Last Modified Date: 10/19/2026 08:16:42
+ */
+
+#pragma once
+
+// NOTE(annad): 12 bytes instead of 32 for float position, uv and normal.
+// Positions and uvs are quantized to their own bounds, so tiled uvs
+// outside [0, 1] survive. Normals are octahedral with 8 bits per component.
+struct PackedVertex
+{
+    u16 position[3];
+    u16 uv[2];
+    u8 normal[2];
+};
+
+struct PackedVertices
+{
+    std::vector<PackedVertex> vertices;
+    Vec3f offset; // NOTE(annad): position = offset + q * scale.
+    Vec3f scale;
+    Vec2f uv_offset; // NOTE(annad): uv = uv_offset + q * uv_scale.
+    Vec2f uv_scale;
+};
+
+void tr_oct_encode(Vec3f n, u8 *out);
+Vec3f tr_oct_decode(const u8 *in);
+void tr_pack_vertices(PackedVertices *packed, Model *model);
+Vec3f tr_unpack_position(const PackedVertices *packed, const PackedVertex *v);
+Vec2f tr_unpack_uv(const PackedVertices *packed, const PackedVertex *v);
+Vec3f tr_unpack_normal(const PackedVertex *v);
@@ -0,0 +1,143 @@
+/**
+ * File: asset_archive.cpp
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 20:41:37
+ * Last Modified Date: 10/19/2026 08:15:34
+ */
+
+// NOTE(annad): Host tool, builds a single-file archive (platform_archive.h).
+//   g++ -O2 -o asset_archive tools/asset_archive.cpp
+//   ./asset_archive DATA.PAK OBJ/AFRICAN_HEAD.OBJ OBJ/AFRICAN_HEAD_DIFFUSE.BMP
+// Paths are stored normalized (upper case, no "./"), run it from the game
+// directory. Files made by asset_pack are flagged ARCHIVE_ENTRY_LZ4.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include <algorithm>
+
+typedef uint8_t  u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+
+#include "../platform_lz4.h"
+#include "../platform_archive.h"
+#include "../platform_archive.cpp"
+
+struct Input
+{
+    const char *path;
+    ArchiveEntry entry;
+    std::vector<u8> data;
+};
+
+bool read_file(const char *path, std::vector<u8> *data)
+{
+    FILE *in = fopen(path, "rb");
+    if (in == NULL)
+        return false;
+
+    fseek(in, 0, SEEK_END);
+    data->resize(ftell(in));
+    fseek(in, 0, SEEK_SET);
+    bool result = data->empty() || fread(&(*data)[0], 1, data->size(), in) == data->size();
+    fclose(in);
+    return result;
+}
+
+bool by_hash(const Input &a, const Input &b)
+{
+    return a.entry.hash < b.entry.hash;
+}
+
+u32 align_up(u32 value)
+{
+    return (value + archive_alignment - 1) & ~(archive_alignment - 1);
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: %s <archive> <file>...\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<Input> inputs(argc - 2);
+    for (int i = 2; i < argc; i += 1)
+    {
+        Input *input = &inputs[i - 2];
+        input->path = argv[i];
+        if (!read_file(input->path, &input->data))
+        {
+            fprintf(stderr, "can't read %s\n", input->path);
+            return 1;
+        }
+
+        u32 magic = 0;
+        if (input->data.size() >= sizeof(Lz4Header))
+            memcpy(&magic, &input->data[0], sizeof(magic));
+
+        if (!archive_path_store(input->entry.path, input->path))
+        {
+            fprintf(stderr, "path too long: %s\n", input->path);
+            return 1;
+        }
+
+        input->entry.hash = archive_hash(input->path);
+        input->entry.size = (u32)input->data.size();
+        input->entry.flags = (magic == lz4_magic) ? ARCHIVE_ENTRY_LZ4 : 0;
+    }
+
+    // NOTE(annad): Data goes in TOC order, so sorted requests read forward.
+    std::sort(inputs.begin(), inputs.end(), by_hash);
+    for (size_t i = 1; i < inputs.size(); i += 1)
+    {
+        if (inputs[i].entry.hash == inputs[i - 1].entry.hash)
+        {
+            fprintf(stderr, "hash collision: %s and %s\n", inputs[i - 1].path, inputs[i].path);
+            return 1;
+        }
+    }
+
+    ArchiveHeader header = {};
+    header.magic = archive_magic;
+    header.version = archive_version;
+    header.entry_count = (u32)inputs.size();
+    header.alignment = archive_alignment;
+
+    u32 offset = align_up(sizeof(header) + header.entry_count * sizeof(ArchiveEntry));
+    for (size_t i = 0; i < inputs.size(); i += 1)
+    {
+        inputs[i].entry.offset = offset;
+        offset = align_up(offset + inputs[i].entry.size);
+    }
+
+    FILE *out = fopen(argv[1], "wb");
+    if (out == NULL)
+    {
+        fprintf(stderr, "can't open %s\n", argv[1]);
+        return 1;
+    }
+
+    fwrite(&header, sizeof(header), 1, out);
+    for (size_t i = 0; i < inputs.size(); i += 1)
+        fwrite(&inputs[i].entry, sizeof(ArchiveEntry), 1, out);
+
+    static const u8 zeros[archive_alignment] = {};
+    u32 at = sizeof(header) + header.entry_count * sizeof(ArchiveEntry);
+    for (size_t i = 0; i < inputs.size(); i += 1)
+    {
+        Input *input = &inputs[i];
+        fwrite(zeros, 1, input->entry.offset - at, out);
+        if (!input->data.empty())
+            fwrite(&input->data[0], 1, input->data.size(), out);
+        at = input->entry.offset + input->entry.size;
+    }
+
+    fclose(out);
+    printf("%s: %d entries, %u bytes\n", argv[1], (int)inputs.size(), at);
+    return 0;
+}
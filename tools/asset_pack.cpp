@@ -0,0 +1,193 @@
+/**
+ * File: asset_pack.cpp
+ * Author: github.com/annadostoevskaya
+ * Date: 10/19/2026 18:58:44
+ * Last Modified Date: 10/19/2026 08:24:17
+ */
+
+// NOTE(annad): Host tool, packs an asset into LZ4 blocks (platform_lz4.h).
+//   g++ -O2 -o asset_pack tools/asset_pack.cpp
+//   ./asset_pack OBJ/AFRICAN_HEAD.OBJ OBJ/AFRICAN_HEAD.OBJ.LZ4
+// The loader recognizes packed files by magic, the name doesn't matter.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef uint8_t  u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+
+#include "../platform_lz4.h"
+
+const int hash_bits = 16;
+const int min_match = 4;
+const int last_literals = 5;  // NOTE(annad): LZ4 end of block rules.
+const int match_limit = 12;
+
+u32 read_u32(const u8 *p)
+{
+    u32 v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+u32 hash4(u32 v)
+{
+    return (v * 2654435761u) >> (32 - hash_bits);
+}
+
+u8 *write_length(u8 *op, size_t length)
+{
+    while (length >= 255)
+    {
+        *op++ = 255;
+        length -= 255;
+    }
+    *op++ = (u8)length;
+    return op;
+}
+
+// NOTE(annad): Greedy single-probe matcher, dst needs lz4_bound(size).
+size_t lz4_compress(const u8 *src, size_t size, u8 *dst)
+{
+    static u32 table[1 << hash_bits];
+    for (size_t i = 0; i < (size_t)(1 << hash_bits); i += 1)
+        table[i] = 0xffffffff;
+
+    const u8 *ip = src;
+    const u8 *anchor = src;
+    const u8 *iend = src + size;
+    const u8 *mflimit = (size > (size_t)match_limit) ? iend - match_limit : src;
+    u8 *op = dst;
+
+    while (ip < mflimit)
+    {
+        u32 h = hash4(read_u32(ip));
+        u32 candidate = table[h];
+        table[h] = (u32)(ip - src);
+
+        if (candidate == 0xffffffff || (size_t)(ip - src) - candidate > 0xffff
+            || read_u32(src + candidate) != read_u32(ip))
+        {
+            ip += 1;
+            continue;
+        }
+
+        const u8 *match = src + candidate;
+        const u8 *mend = iend - last_literals;
+        size_t length = min_match;
+        while (ip + length < mend && ip[length] == match[length])
+            length += 1;
+
+        size_t literals = ip - anchor;
+        u8 *token = op++;
+        *token = (u8)(((literals >= 15) ? 15 : literals) << 4);
+        if (literals >= 15)
+            op = write_length(op, literals - 15);
+        memcpy(op, anchor, literals);
+        op += literals;
+
+        size_t offset = ip - match;
+        *op++ = (u8)(offset & 0xff);
+        *op++ = (u8)(offset >> 8);
+
+        size_t extra = length - min_match;
+        *token |= (u8)((extra >= 15) ? 15 : extra);
+        if (extra >= 15)
+            op = write_length(op, extra - 15);
+
+        ip += length;
+        anchor = ip;
+    }
+
+    size_t literals = iend - anchor;
+    u8 *token = op++;
+    *token = (u8)(((literals >= 15) ? 15 : literals) << 4);
+    if (literals >= 15)
+        op = write_length(op, literals - 15);
+    memcpy(op, anchor, literals);
+    op += literals;
+
+    return op - dst;
+}
+
+size_t lz4_bound(size_t size)
+{
+    return size + size / 255 + 16;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 3)
+    {
+        fprintf(stderr, "usage: %s <input> <output>\n", argv[0]);
+        return 1;
+    }
+
+    FILE *in = fopen(argv[1], "rb");
+    if (in == NULL)
+    {
+        fprintf(stderr, "can't open %s\n", argv[1]);
+        return 1;
+    }
+
+    fseek(in, 0, SEEK_END);
+    size_t size = ftell(in);
+    fseek(in, 0, SEEK_SET);
+    u8 *data = (u8*)malloc(size ? size : 1);
+    if (fread(data, 1, size, in) != size)
+    {
+        fprintf(stderr, "can't read %s\n", argv[1]);
+        return 1;
+    }
+    fclose(in);
+
+    // NOTE(annad): The loader rejects raw_size 0, there is nothing to pack.
+    if (size == 0)
+    {
+        fprintf(stderr, "%s is empty\n", argv[1]);
+        return 1;
+    }
+
+    FILE *out = fopen(argv[2], "wb");
+    if (out == NULL)
+    {
+        fprintf(stderr, "can't open %s\n", argv[2]);
+        return 1;
+    }
+
+    Lz4Header header = {};
+    header.magic = lz4_magic;
+    header.raw_size = (u32)size;
+    header.block_size = lz4_block_size;
+    header.block_count = (u32)((size + lz4_block_size - 1) / lz4_block_size);
+    fwrite(&header, sizeof(header), 1, out);
+
+    u8 *block = (u8*)malloc(lz4_bound(lz4_block_size));
+    size_t packed = sizeof(header);
+    for (size_t at = 0; at < size; at += lz4_block_size)
+    {
+        size_t raw = (size - at < lz4_block_size) ? size - at : lz4_block_size;
+        size_t compressed = lz4_compress(data + at, raw, block);
+
+        u32 tag = (u32)compressed;
+        const u8 *payload = block;
+        if (compressed >= raw)
+        {
+            tag = (u32)raw | lz4_block_stored;
+            compressed = raw;
+            payload = data + at;
+        }
+
+        fwrite(&tag, sizeof(tag), 1, out);
+        fwrite(payload, 1, compressed, out);
+        packed += sizeof(tag) + compressed;
+    }
+
+    fclose(out);
+    printf("%s: %zu -> %zu bytes (%.1f%%)\n", argv[1], size, packed,
+        size ? 100.0 * (double)packed / (double)size : 100.0);
+    return 0;
+}
@@ -0,0 +1,36 @@
+/**
+ * File: frame_replay.cpp
+ * Author: github.com/annadostoevskaya
+ * Date: 10/20/2026 00:42:17
+ * Last Modified Date: 10/19/2026 08:23:45
+ */
+
+// NOTE(annad): Host check of the frame scheduler, replays frame_replay on
+// the fake clock and exits with 1 when the counts don't match.
+//   g++ -O2 -o frame_replay tools/frame_replay.cpp && ./frame_replay
+
+#include <stdio.h>
+#include <stdint.h>
+
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef float SceFloat32;
+
+#include "../platform_frame.h"
+#include "../platform_frame.cpp"
+
+int main()
+{
+    FrameReplay replay;
+    bool ok = frame_replay(&replay);
+    printf("frame_replay: steps %u late %u dropped %u overshoot %uus avg %.3fms p50 %.1fms p99 %.1fms %s\n",
+        replay.steps, replay.late, replay.dropped, (u32)replay.overshoot,
+        replay.avg_ms, replay.p50_ms, replay.p99_ms, ok ? "[OK]" : "[FAILED]");
+    if (!ok)
+    {
+        printf("frame_replay: expected steps %u late %u dropped %u overshoot <= %uus\n",
+            frame_replay_steps, frame_replay_late, frame_replay_dropped,
+            (u32)frame_replay_max_overshoot);
+    }
+    return ok ? 0 : 1;
+}